@@ -13,6 +13,11 @@
 // Default display refresh period
 #define LV_DISP_DEF_REFR_PERIOD 30
 
+// Tick source: millis(), so lv_timer_handler() deadlines are real
+#define LV_TICK_CUSTOM          1
+#define LV_TICK_CUSTOM_INCLUDE  "Arduino.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())
+
 // Enable GPU
 #define LV_USE_GPU              0
 
@@ -3,8 +3,8 @@
 
 // Static member definitions
 bool ConfigLoader::initialized = false;
-String ConfigLoader::configValues[50];
-const char* ConfigLoader::configKeys[50];
+String ConfigLoader::configValues[MAX_CONFIG_ENTRIES];
+const char* ConfigLoader::configKeys[MAX_CONFIG_ENTRIES];
 int ConfigLoader::configCount = 0;
 
 bool ConfigLoader::load() {
@@ -37,13 +37,13 @@ bool ConfigLoader::load() {
   
   // Clear arrays
   configCount = 0;
-  for (int i = 0; i < 50; i++) {
+  for (int i = 0; i < MAX_CONFIG_ENTRIES; i++) {
     configKeys[i] = nullptr;
     configValues[i] = "";
   }
   
   // Parse file line by line
-  while (file.available() && configCount < 50) {
+  while (file.available() && configCount < MAX_CONFIG_ENTRIES) {
     String line = file.readStringUntil('\n');
     line.trim();
     
@@ -113,6 +113,21 @@ String ConfigLoader::getValue(const char* key, const String& defaultValue) {
   return defaultValue;
 }
 
+String ConfigLoader::getListValue(const char* key, int index, const String& defaultValue) {
+  // Comma-separated list, the last entry applies to any index beyond it
+  String list = getValue(key, defaultValue);
+  int start = 0;
+  for (int i = 0; i < index; i++) {
+    int comma = list.indexOf(',', start);
+    if (comma < 0) break;
+    start = comma + 1;
+  }
+  int end = list.indexOf(',', start);
+  String item = end < 0 ? list.substring(start) : list.substring(start, end);
+  item.trim();
+  return item;
+}
+
 // WiFi Configuration
 String ConfigLoader::getWifiSSID() {
   return getValue("WIFI_SSID", "Polaris");
@@ -136,6 +151,39 @@ bool ConfigLoader::isTelegramEnabled() {
   return value.equalsIgnoreCase("true");
 }
 
+bool ConfigLoader::isTelegramCommandsEnabled() {
+  String value = getValue("TELEGRAM_COMMANDS_ENABLED", "true");
+  return value.equalsIgnoreCase("true");
+}
+
+unsigned long ConfigLoader::getTelegramPollIntervalMs() {
+  return getValue("TELEGRAM_POLL_INTERVAL_MS", "10000").toInt();
+}
+
+// Webhook Configuration
+bool ConfigLoader::isWebhookEnabled() {
+  String value = getValue("WEBHOOK_ENABLED", "false");
+  return value.equalsIgnoreCase("true");
+}
+
+String ConfigLoader::getWebhookUrl() {
+  return getValue("WEBHOOK_URL", "");
+}
+
+// Syslog Configuration
+bool ConfigLoader::isSyslogEnabled() {
+  String value = getValue("SYSLOG_ENABLED", "false");
+  return value.equalsIgnoreCase("true");
+}
+
+String ConfigLoader::getSyslogHost() {
+  return getValue("SYSLOG_HOST", "");
+}
+
+int ConfigLoader::getSyslogPort() {
+  return getValue("SYSLOG_PORT", "514").toInt();
+}
+
 // Alert Configuration
 int ConfigLoader::getMaxFailuresBeforeAlert() {
   return getValue("MAX_FAILURES_BEFORE_ALERT", "3").toInt();
@@ -149,6 +197,38 @@ unsigned long ConfigLoader::getAlertRecoveryCooldownMs() {
   return getValue("ALERT_RECOVERY_COOLDOWN_MS", "60000").toInt();
 }
 
+int ConfigLoader::getAlertWindowSize() {
+  return getValue("ALERT_WINDOW_SIZE", "0").toInt();
+}
+
+int ConfigLoader::getAlertWindowFailures() {
+  return getValue("ALERT_WINDOW_FAILURES", "0").toInt();
+}
+
+int ConfigLoader::getFlapHighThreshold() {
+  return getValue("FLAP_HIGH_THRESHOLD", "50").toInt();
+}
+
+int ConfigLoader::getFlapLowThreshold() {
+  return getValue("FLAP_LOW_THRESHOLD", "25").toInt();
+}
+
+unsigned long ConfigLoader::getLatencySloP95Ms() {
+  return getValue("LATENCY_SLO_P95_MS", "0").toInt();
+}
+
+unsigned long ConfigLoader::getLatencySloSustainMs() {
+  return getValue("LATENCY_SLO_SUSTAIN_MS", "300000").toInt();
+}
+
+unsigned long ConfigLoader::getSlaCheckpointIntervalMs() {
+  return getValue("SLA_CHECKPOINT_INTERVAL_MS", "600000").toInt();
+}
+
+unsigned long ConfigLoader::getMaintenanceProbeIntervalMs() {
+  return getValue("MAINTENANCE_PROBE_INTERVAL_MS", "300000").toInt();
+}
+
 // Debug Configuration
 bool ConfigLoader::isDebugLogsEnabled() {
   String value = getValue("DEBUG_LOGS_ENABLED", "false");
@@ -238,10 +318,43 @@ String ConfigLoader::getTargetMonitorType(int index) {
   String value = getValue(key.c_str(), "");
   if (value.length() == 0) return "PING";
   
-  int pipe3 = value.lastIndexOf('|');
-  if (pipe3 == -1) return "PING";
+  // MONITOR_TYPE is the 4th field, optional key=value fields may follow
+  int pipe3 = -1;
+  for (int i = 0; i < 3; i++) {
+    pipe3 = value.indexOf('|', pipe3 + 1);
+    if (pipe3 == -1) return "PING";
+  }
   
-  return value.substring(pipe3 + 1);
+  int pipe4 = value.indexOf('|', pipe3 + 1);
+  return pipe4 == -1 ? value.substring(pipe3 + 1) : value.substring(pipe3 + 1, pipe4);
+}
+
+String ConfigLoader::getTargetOption(int index, const char* option, const String& defaultValue) {
+  String key = "TARGET_" + String(index + 1);
+  String value = getValue(key.c_str(), "");
+  if (value.length() == 0) return defaultValue;
+  
+  // Options start after the 4th field: NAME|URL|HEALTH|TYPE|key=value|key=value
+  int pos = -1;
+  for (int i = 0; i < 4; i++) {
+    pos = value.indexOf('|', pos + 1);
+    if (pos == -1) return defaultValue;
+  }
+  
+  size_t optionLength = strlen(option);
+  while (pos != -1) {
+    int start = pos + 1;
+    pos = value.indexOf('|', start);
+    String field = pos == -1 ? value.substring(start) : value.substring(start, pos);
+    field.trim();
+    
+    if (field.length() > optionLength && field.charAt(optionLength) == '=' &&
+        strncmp(field.c_str(), option, optionLength) == 0) {
+      return field.substring(optionLength + 1);
+    }
+  }
+  
+  return defaultValue;
 }
 
 // Display Configuration
@@ -295,6 +408,81 @@ unsigned long ConfigLoader::getScanIntervalMs() {
   return getValue("SCAN_INTERVAL_MS", "30000").toInt();
 }
 
+unsigned long ConfigLoader::getStalenessBoundMs() {
+  return getValue("SCAN_STALENESS_BOUND_MS", "0").toInt();
+}
+
+unsigned long ConfigLoader::getDnsCacheTtlMs() {
+  return getValue("DNS_CACHE_TTL_MS", "300000").toInt();
+}
+
+unsigned long ConfigLoader::getDnsNegativeTtlMs() {
+  return getValue("DNS_NEGATIVE_TTL_MS", "30000").toInt();
+}
+
+bool ConfigLoader::isConditionalGetEnabled() {
+  String value = getValue("CONDITIONAL_GET_ENABLED", "true");
+  return value.equalsIgnoreCase("true");
+}
+
+int ConfigLoader::getProbeWorkerCount() {
+  // 0 keeps probing on the scanner task; the pool caps the upper end
+  int workers = getValue("PROBE_WORKERS", "2").toInt();
+  return workers < 0 ? 0 : workers;
+}
+
+int ConfigLoader::getProbeWorkerCore(int worker) {
+  // Core per worker ("0,1"), "any" lets the scheduler place it
+  String core = getListValue("PROBE_WORKER_CORES", worker, "0,1");
+  if (core.equalsIgnoreCase("any")) return -1;
+  return core.toInt() == 1 ? 1 : 0;
+}
+
+uint32_t ConfigLoader::getProbeWorkerStackSize(int worker) {
+  // Stack per worker in bytes, a TLS handshake needs about 6KB
+  uint32_t stackSize = getListValue("PROBE_WORKER_STACK", worker, "8192").toInt();
+  return stackSize < 4096 ? 4096 : stackSize;
+}
+
+int ConfigLoader::getAsyncProbeSlots() {
+  // Plain HTTP probes in flight on the scanner task, each holds one lwIP socket
+  int slots = getValue("ASYNC_PROBE_SLOTS", "6").toInt();
+  return slots < 0 ? 0 : slots;
+}
+
+unsigned long ConfigLoader::getCpuSampleIntervalMs() {
+  return getValue("CPU_SAMPLE_INTERVAL_MS", "2000").toInt();
+}
+
+bool ConfigLoader::isWatchdogEnabled() {
+  String value = getValue("WATCHDOG_ENABLED", "true");
+  return value.equalsIgnoreCase("true");
+}
+
+unsigned long ConfigLoader::getWatchdogTimeoutS() {
+  return getValue("WATCHDOG_TIMEOUT_S", "10").toInt();
+}
+
+String ConfigLoader::getStackTuningMode() {
+  return getValue("STACK_TUNING", "record");
+}
+
+int ConfigLoader::getStackTuningMargin() {
+  // Percent, kept within what the tuner's uint8_t holds
+  int margin = getValue("STACK_TUNING_MARGIN", "25").toInt();
+  if (margin > 200) margin = 200;
+  return margin < 10 ? 10 : margin;
+}
+
+int ConfigLoader::getTlsMaxSessions() {
+  int sessions = getValue("TLS_MAX_SESSIONS", "2").toInt();
+  return sessions < 1 ? 1 : sessions;
+}
+
+unsigned long ConfigLoader::getTlsSessionHeap() {
+  return getValue("TLS_SESSION_HEAP", "45000").toInt();
+}
+
 unsigned long ConfigLoader::getTouchFilterMs() {
   return getValue("TOUCH_FILTER_MS", "500").toInt();
 }
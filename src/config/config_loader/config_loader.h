@@ -5,14 +5,17 @@
 
 class ConfigLoader {
 private:
+  static const int MAX_CONFIG_ENTRIES = 96;
+  
   static bool initialized;
-  static String configValues[50];
-  static const char* configKeys[50];
+  static String configValues[MAX_CONFIG_ENTRIES];
+  static const char* configKeys[MAX_CONFIG_ENTRIES];
   static int configCount;
   
   // Internal methods
   static void parseConfigLine(const String& line);
   static String getValue(const char* key, const String& defaultValue = "");
+  static String getListValue(const char* key, int index, const String& defaultValue);
   
 public:
   // Initialization
@@ -28,11 +31,30 @@ public:
   static String getTelegramBotToken();
   static String getTelegramChatId();
   static bool isTelegramEnabled();
+  static bool isTelegramCommandsEnabled();
+  static unsigned long getTelegramPollIntervalMs();
+  
+  // Webhook Configuration
+  static bool isWebhookEnabled();
+  static String getWebhookUrl();
+  
+  // Syslog Configuration
+  static bool isSyslogEnabled();
+  static String getSyslogHost();
+  static int getSyslogPort();
   
   // Alert Configuration
   static int getMaxFailuresBeforeAlert();
   static unsigned long getAlertCooldownMs();
   static unsigned long getAlertRecoveryCooldownMs();
+  static int getAlertWindowSize();
+  static int getAlertWindowFailures();
+  static int getFlapHighThreshold();
+  static int getFlapLowThreshold();
+  static unsigned long getLatencySloP95Ms();
+  static unsigned long getLatencySloSustainMs();
+  static unsigned long getSlaCheckpointIntervalMs();
+  static unsigned long getMaintenanceProbeIntervalMs();
   
   // Debug Configuration
   static bool isDebugLogsEnabled();
@@ -47,6 +69,7 @@ public:
   static String getTargetUrl(int index);
   static String getTargetHealthEndpoint(int index);
   static String getTargetMonitorType(int index);
+  static String getTargetOption(int index, const char* option, const String& defaultValue = "");
   
   // Display Configuration
   static int getDisplayRotation();
@@ -65,6 +88,21 @@ public:
   
   // Performance Configuration
   static unsigned long getScanIntervalMs();
+  static unsigned long getStalenessBoundMs();
+  static unsigned long getDnsCacheTtlMs();
+  static unsigned long getDnsNegativeTtlMs();
+  static bool isConditionalGetEnabled();
+  static int getProbeWorkerCount();
+  static int getProbeWorkerCore(int worker);
+  static uint32_t getProbeWorkerStackSize(int worker);
+  static int getAsyncProbeSlots();
+  static unsigned long getCpuSampleIntervalMs();
+  static bool isWatchdogEnabled();
+  static unsigned long getWatchdogTimeoutS();
+  static String getStackTuningMode();
+  static int getStackTuningMargin();
+  static int getTlsMaxSessions();
+  static unsigned long getTlsSessionHeap();
   static unsigned long getTouchFilterMs();
   static unsigned long getHttpTimeoutMs();
   
@@ -5,11 +5,104 @@ Alert::Alert(int index, const String& name)
   : targetIndex(index), targetName(name ? name : "Unknown"), 
     currentStatus(UNKNOWN), lastStatus(UNKNOWN), failureCount(0),
     firstFailureTime(0), lastAlertTime(0), isActive(false), 
-    alertSent(false), lastLatency(0), alertDowntimeStart(0), totalDowntime(0) {
+    alertSent(false), alertPending(false), lastLatency(0), alertDowntimeStart(0), totalDowntime(0),
+    windowBits(0), windowCount(0), windowFailureCount(0),
+    transitionBits(0), historyCount(0), transitionCount(0), lastFailed(false),
+    flapping(false), flapStartTime(0), flapStateChanges(0),
+    pendingFlapTransition(FlapTransition::NONE) {
+}
+
+void Alert::setPolicy(const AlertPolicy& newPolicy) {
+  policy = newPolicy;
+  policy.normalize();
+  clearWindow();
+  
+  transitionBits = 0;
+  historyCount = 0;
+  transitionCount = 0;
+  flapping = false;
+  pendingFlapTransition = FlapTransition::NONE;
+}
+
+void Alert::clearWindow() {
+  windowBits = 0;
+  windowCount = 0;
+  windowFailureCount = 0;
+}
+
+void Alert::recordResult(bool failed) {
+  if (policy.windowSize == 0) return;
+  
+  // Slide the window: drop the oldest bit once full, then shift in the newest
+  if (windowCount == policy.windowSize) {
+    windowFailureCount -= (windowBits >> (policy.windowSize - 1)) & 1;
+  } else {
+    windowCount++;
+  }
+  
+  uint32_t mask = policy.windowSize >= 32 ? 0xFFFFFFFFu : ((1u << policy.windowSize) - 1);
+  windowBits = ((windowBits << 1) | (failed ? 1 : 0)) & mask;
+  windowFailureCount += failed ? 1 : 0;
+}
+
+void Alert::recordTransition(bool failed) {
+  if (!policy.hasFlapDetection()) return;
+  
+  bool changed = historyCount > 0 && failed != lastFailed;
+  lastFailed = failed;
+  
+  if (historyCount < AlertPolicy::FLAP_HISTORY_SIZE) {
+    historyCount++;
+  }
+  
+  if (historyCount > 1) {
+    // Slide the 20-transition window, same scheme as the failure window
+    const uint8_t transitions = AlertPolicy::FLAP_HISTORY_SIZE - 1;
+    if (historyCount == AlertPolicy::FLAP_HISTORY_SIZE) {
+      transitionCount -= (transitionBits >> (transitions - 1)) & 1;
+    }
+    transitionBits = ((transitionBits << 1) | (changed ? 1 : 0)) & ((1u << transitions) - 1);
+    transitionCount += changed ? 1 : 0;
+  }
+  
+  if (flapping && changed) {
+    flapStateChanges++;
+  }
+  
+  // Hysteresis: separate thresholds to enter and leave the flapping state
+  uint8_t percent = getStateChangePercent();
+  if (!flapping && percent >= policy.flapHighPercent) {
+    flapping = true;
+    flapStartTime = millis();
+    flapStateChanges = transitionCount;
+    pendingFlapTransition = FlapTransition::STARTED;
+    Serial_printf("[ALERT] %s: Flapping detected (%u%% state change)\n", targetName.c_str(), percent);
+  } else if (flapping && percent < policy.flapLowPercent) {
+    flapping = false;
+    pendingFlapTransition = FlapTransition::STOPPED;
+    Serial_printf("[ALERT] %s: Flapping stopped (%u%% state change)\n", targetName.c_str(), percent);
+  }
+}
+
+uint8_t Alert::getStateChangePercent() const {
+  // Always relative to the full window so a short history can't trigger early
+  return (uint8_t)(transitionCount * 100 / (AlertPolicy::FLAP_HISTORY_SIZE - 1));
+}
+
+unsigned long Alert::getFlapDuration() const {
+  return flapStartTime > 0 ? (millis() - flapStartTime) / 1000 : 0;
+}
+
+FlapTransition Alert::takeFlapTransition() {
+  FlapTransition transition = pendingFlapTransition;
+  pendingFlapTransition = FlapTransition::NONE;
+  return transition;
 }
 
 void Alert::updateStatus(Status newStatus, uint16_t latency) {
   lastLatency = latency;
+  recordResult(newStatus != UP);
+  recordTransition(newStatus != UP);
   
   if (currentStatus != newStatus) {
     lastStatus = currentStatus;
@@ -28,7 +121,7 @@ void Alert::updateStatus(Status newStatus, uint16_t latency) {
     } else if (newStatus == UP && (lastStatus == DOWN || lastStatus == UNKNOWN)) {
       // Recovery detected
       Serial_printf("[ALERT] %s: Recovery detected\n", targetName.c_str());
-      if (alertSent) {
+      if (alertSent || alertPending) {
         // Don't mark as recovered yet - let the recovery logic handle it
       } else {
         // Reset downtime tracking even if no alert was sent
@@ -48,11 +141,18 @@ void Alert::updateStatus(Status newStatus, uint16_t latency) {
 bool Alert::shouldSendAlert() const {
   // CRITICAL FIX: Alert on both DOWN and UNKNOWN status
   if (currentStatus != DOWN && currentStatus != UNKNOWN) return false;
-  if (failureCount < MAX_FAILURES_BEFORE_ALERT) return false;
+  if (flapping) return false; // Summarized by flap notifications instead
+  if (alertPending) return false; // Already queued, waiting for its receipt
+  
+  bool consecutiveTriggered = failureCount >= policy.consecutiveFailures;
+  bool windowTriggered = policy.hasWindowTrigger() &&
+                         windowCount == policy.windowSize &&
+                         windowFailureCount >= policy.windowFailures;
+  if (!consecutiveTriggered && !windowTriggered) return false;
   
   // Check cooldown - allow re-sending after cooldown period
   unsigned long now = millis();
-  if (lastAlertTime > 0 && (now - lastAlertTime) < ALERT_COOLDOWN_MS) {
+  if (lastAlertTime > 0 && (now - lastAlertTime) < policy.alertCooldownMs) {
     return false;
   }
   
@@ -61,19 +161,26 @@ bool Alert::shouldSendAlert() const {
 
 bool Alert::shouldSendRecovery() const {
   if (currentStatus != UP) return false;
+  if (flapping) return false;
   if (!alertSent) return false;
   if (alertDowntimeStart == 0) return false;
   
   // Check recovery cooldown
   unsigned long now = millis();
-  if (lastAlertTime > 0 && (now - lastAlertTime) < ALERT_RECOVERY_COOLDOWN_MS) {
+  if (lastAlertTime > 0 && (now - lastAlertTime) < policy.recoveryCooldownMs) {
     return false;
   }
   
   return true;
 }
 
+void Alert::markAlertQueued() {
+  alertPending = true;
+  Serial_printf("[ALERT] %s: Alert queued for delivery\n", targetName.c_str());
+}
+
 void Alert::markAlertSent() {
+  alertPending = false;
   alertSent = true;
   lastAlertTime = millis();
   alertDowntimeStart = firstFailureTime > 0 ? firstFailureTime : millis();
@@ -81,6 +188,17 @@ void Alert::markAlertSent() {
   Serial_printf("[ALERT] %s: Alert marked as sent\n", targetName.c_str());
 }
 
+void Alert::markAlertUndelivered() {
+  // No backend took it: shouldSendAlert() raises it again on the next failure
+  alertPending = false;
+  if (!alertSent && currentStatus == UP) {
+    // Recovered meanwhile, nothing left to report
+    firstFailureTime = 0;
+    failureCount = 0;
+  }
+  Serial_printf("[ALERT] %s: Alert not delivered by any backend, will retry\n", targetName.c_str());
+}
+
 void Alert::markRecovered() {
   // Save total downtime before resetting
   if (firstFailureTime > 0) {
@@ -120,17 +238,21 @@ void Alert::reset() {
   lastAlertTime = 0;
   isActive = false;
   alertSent = false;
+  alertPending = false;
   lastLatency = 0;
   alertDowntimeStart = 0;
   totalDowntime = 0;
   currentStatus = UNKNOWN;
   lastStatus = UNKNOWN;
+  clearWindow();
+  // Flap history is kept, it spans alert episodes
   
   Serial_printf("[ALERT] %s: Reset complete - clean state for new alerts\n", targetName.c_str());
 }
 
 void Alert::printState() const {
-  Serial_printf("[ALERT] %s: status=%d, failures=%d, active=%s, sent=%s\n",
-               targetName.c_str(), currentStatus, failureCount,
-               isActive ? "true" : "false", alertSent ? "true" : "false");
+  Serial_printf("[ALERT] %s: status=%d, failures=%d, window=%d/%d, flapping=%s (%u%%), active=%s, sent=%s\n",
+               targetName.c_str(), currentStatus, failureCount, windowFailureCount, windowCount,
+               flapping ? "true" : "false", getStateChangePercent(),
+               isActive ? "true" : "false", alertSent ? "true" : (alertPending ? "pending" : "false"));
 }
@@ -1,7 +1,15 @@
 #pragma once
 #include "core/domain/status/status.h"
+#include "core/domain/alert_policy/alert_policy.h"
 #include <Arduino.h>
 
+// Flap state transitions reported once to the alert layer
+enum class FlapTransition : uint8_t {
+  NONE,
+  STARTED,
+  STOPPED
+};
+
 class Alert {
 private:
   int targetIndex;
@@ -13,24 +21,42 @@ private:
   unsigned long lastAlertTime;
   bool isActive;
   bool alertSent;
+  bool alertPending;        // queued, waiting for a backend to deliver it
   uint16_t lastLatency;
   unsigned long alertDowntimeStart;
   unsigned long totalDowntime;
   
-  // Configuration constants
-  static const uint8_t MAX_FAILURES_BEFORE_ALERT = 3;
-  static const unsigned long ALERT_COOLDOWN_MS = 300000; // 5 minutes
-  static const unsigned long ALERT_RECOVERY_COOLDOWN_MS = 60000; // 1 minute
+  // Policy and failure window (bit 0 = newest result, 1 = failed)
+  AlertPolicy policy;
+  uint32_t windowBits;
+  uint8_t windowCount;      // results recorded so far, up to policy.windowSize
+  uint8_t windowFailureCount; // set bits in the window, maintained incrementally
+  
+  // Flap detection (bit 0 = newest transition, 1 = state changed)
+  uint32_t transitionBits;
+  uint8_t historyCount;     // results recorded, up to FLAP_HISTORY_SIZE
+  uint8_t transitionCount;  // set bits in transitionBits
+  bool lastFailed;
+  bool flapping;
+  unsigned long flapStartTime;
+  uint16_t flapStateChanges;
+  FlapTransition pendingFlapTransition;
   
 public:
   // Constructor
-  Alert(int index, const String& name);
+  Alert(int index = -1, const String& name = "Unknown");
+  
+  // Policy
+  void setPolicy(const AlertPolicy& newPolicy);
+  const AlertPolicy& getPolicy() const { return policy; }
   
   // Status management
   void updateStatus(Status newStatus, uint16_t latency);
   bool shouldSendAlert() const;
   bool shouldSendRecovery() const;
+  void markAlertQueued();
   void markAlertSent();
+  void markAlertUndelivered();
   void markRecovered();
   void reset(); // Reset all alert data for clean state
   
@@ -42,14 +68,29 @@ public:
   Status getCurrentStatus() const { return currentStatus; }
   Status getLastStatus() const { return lastStatus; }
   bool hasAlertBeenSent() const { return alertSent; }
+  bool isAlertPending() const { return alertPending; }
   unsigned long getLastAlertTime() const { return lastAlertTime; }
   uint16_t getLastLatency() const { return lastLatency; }
   unsigned long getFirstFailureTime() const { return firstFailureTime; }
   unsigned long getAlertDowntimeStart() const { return alertDowntimeStart; }
+  uint8_t getWindowFailureCount() const { return windowFailureCount; }
+  uint8_t getWindowCount() const { return windowCount; }
+  
+  // Flap detection
+  bool isFlapping() const { return flapping; }
+  uint8_t getStateChangePercent() const;
+  uint16_t getFlapStateChanges() const { return flapStateChanges; }
+  unsigned long getFlapDuration() const;
+  FlapTransition takeFlapTransition();
   
   // Setters
   void setTargetName(const String& name);
   
   // Debug
   void printState() const;
+  
+private:
+  void recordResult(bool failed);
+  void clearWindow();
+  void recordTransition(bool failed);
 };
@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @brief Per-target alert policy, resolved once when targets are loaded
+ * 
+ * A target alerts when either trigger fires:
+ * - consecutiveFailures results in a row have failed, or
+ * - windowFailures of the last windowSize results have failed
+ *   (windowSize 0 disables the ratio trigger).
+ * Alert and recovery notifications have independent cooldowns.
+ * 
+ * Flap detection uses the percent of state changes over the last
+ * FLAP_HISTORY_SIZE results with hysteresis: flapping starts at
+ * flapHighPercent and ends below flapLowPercent (0 disables it).
+ */
+struct AlertPolicy {
+  static const uint8_t MAX_WINDOW_SIZE = 32; // Window is kept as a bitmask
+  static const uint8_t FLAP_HISTORY_SIZE = 21; // 21 results = 20 possible transitions
+  
+  uint8_t consecutiveFailures = 3;
+  uint8_t windowSize = 0;
+  uint8_t windowFailures = 0;
+  uint32_t alertCooldownMs = 300000;     // 5 minutes
+  uint32_t recoveryCooldownMs = 60000;   // 1 minute
+  uint8_t flapHighPercent = 50;
+  uint8_t flapLowPercent = 25;
+  
+  bool hasWindowTrigger() const { return windowSize > 0 && windowFailures > 0; }
+  bool hasFlapDetection() const { return flapHighPercent > 0; }
+  
+  // Clamp values from config.env into the supported range
+  void normalize() {
+    if (consecutiveFailures == 0) consecutiveFailures = 1;
+    if (windowSize > MAX_WINDOW_SIZE) windowSize = MAX_WINDOW_SIZE;
+    if (windowFailures > windowSize) windowFailures = windowSize;
+    if (flapHighPercent > 100) flapHighPercent = 100;
+    if (flapLowPercent > flapHighPercent) flapLowPercent = flapHighPercent;
+  }
+};
@@ -0,0 +1,114 @@
+#include "core/domain/latency_history/latency_history.h"
+
+LatencyHistory::LatencyHistory()
+  : records(nullptr), capacity(0), head(0), count(0), baseLatency(0), lastLatency(0),
+    lock(portMUX_INITIALIZER_UNLOCKED) {
+}
+
+void LatencyHistory::attach(uint16_t* storage, uint16_t size) {
+  portENTER_CRITICAL(&lock);
+  records = storage;
+  capacity = size;
+  portEXIT_CRITICAL(&lock);
+  clear();
+}
+
+void LatencyHistory::clear() {
+  portENTER_CRITICAL(&lock);
+  head = 0;
+  count = 0;
+  baseLatency = 0;
+  lastLatency = 0;
+  portEXIT_CRITICAL(&lock);
+}
+
+uint16_t LatencyHistory::encode(Status status, int16_t delta) {
+  // Zigzag keeps small deltas of either sign in the low bits
+  uint16_t zigzag = (uint16_t)((delta << 1) ^ (delta >> 15)) & 0x3FFF;
+  return ((uint16_t)status << 14) | zigzag;
+}
+
+int16_t LatencyHistory::decodeDelta(uint16_t record) {
+  uint16_t zigzag = record & 0x3FFF;
+  return (int16_t)(zigzag >> 1) ^ -(int16_t)(zigzag & 1);
+}
+
+void LatencyHistory::record(Status status, uint16_t latency) {
+  if (!records || capacity == 0) return;
+  
+  portENTER_CRITICAL(&lock);
+  append(status, latency);
+  portEXIT_CRITICAL(&lock);
+}
+
+void LatencyHistory::append(Status status, uint16_t latency) {
+  // Only successful probes move the latency chain
+  int16_t delta = 0;
+  if (status == UP) {
+    int32_t diff = (int32_t)latency - lastLatency;
+    if (diff > MAX_DELTA) diff = MAX_DELTA;
+    if (diff < -MAX_DELTA) diff = -MAX_DELTA;
+    delta = (int16_t)diff;
+  }
+  
+  if (count == 0) {
+    // First record: the base carries the absolute value
+    baseLatency = status == UP ? latency : 0;
+    lastLatency = baseLatency;
+    records[head] = encode(status, 0);
+    count = 1;
+    return;
+  }
+  
+  lastLatency = (uint16_t)(lastLatency + delta);
+  
+  if (count < capacity) {
+    records[(head + count) % capacity] = encode(status, delta);
+    count++;
+    return;
+  }
+  
+  // Full: the next-oldest record becomes the base, then reuse the oldest slot
+  uint16_t next = (head + 1) % capacity;
+  baseLatency = (uint16_t)(baseLatency + decodeDelta(records[next]));
+  records[head] = encode(status, delta);
+  head = next;
+}
+
+LatencyHistory::Cursor LatencyHistory::snapshot(uint16_t* buffer, uint16_t size) const {
+  portENTER_CRITICAL(&lock);
+  uint16_t copied = count < size ? count : size;
+  uint16_t skipped = count - copied;
+  
+  // Samples left out move the base up to the first one copied
+  uint16_t base = baseLatency;
+  for (uint16_t i = 1; i <= skipped; i++) {
+    base = (uint16_t)(base + decodeDelta(records[(head + i) % capacity]));
+  }
+  for (uint16_t i = 0; i < copied; i++) {
+    buffer[i] = records[(head + skipped + i) % capacity];
+  }
+  portEXIT_CRITICAL(&lock);
+  
+  return Cursor(buffer, copied, base);
+}
+
+LatencyHistory::Cursor::Cursor(const uint16_t* copy, uint16_t size, uint16_t baseLatency)
+  : records(copy), count(size), position(0), latency(baseLatency) {
+}
+
+bool LatencyHistory::Cursor::next(LatencySample& sample) {
+  if (position >= count) return false;
+  
+  uint16_t record = records[position];
+  
+  // The first record's delta points at a sample not copied, the base replaces it
+  if (position > 0) {
+    latency = (uint16_t)(latency + decodeDelta(record));
+  }
+  position++;
+  
+  sample.status = decodeStatus(record);
+  sample.latency = sample.status == UP ? latency : 0;
+  return true;
+}
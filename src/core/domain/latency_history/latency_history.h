@@ -0,0 +1,76 @@
+#pragma once
+#include "core/domain/status/status.h"
+#include "freertos/FreeRTOS.h"
+#include <Arduino.h>
+
+// One decoded history entry
+struct LatencySample {
+  Status status;
+  uint16_t latency;   // 0 unless status == UP
+};
+
+/**
+ * @brief Per-target status/latency history in a caller-owned ring
+ * 
+ * Each sample is one 16-bit record: 2 bits of status and a 14-bit
+ * zigzag latency delta (ms) against the previous successful sample.
+ * The absolute latency of the oldest record is kept as a base and
+ * advanced on eviction, so appending is O(1) and never allocates.
+ * Deltas beyond +/-8191 ms saturate; the encoder tracks the decoded
+ * value, so the error is corrected by the next sample.
+ * 
+ * Storage is attached once (a slice of NetworkMonitor's arena). The
+ * scanner appends while other tasks read, so readers never decode the
+ * ring in place: snapshot() copies it oldest first into a caller buffer
+ * under a short critical section, and a Cursor decodes that copy.
+ */
+class LatencyHistory {
+public:
+  static const int16_t MAX_DELTA = 8191;
+  
+  class Cursor {
+  private:
+    const uint16_t* records;
+    uint16_t count;
+    uint16_t position;
+    uint16_t latency;
+    
+  public:
+    Cursor(const uint16_t* records, uint16_t count, uint16_t baseLatency);
+    
+    // Decodes the next sample, oldest first; false when exhausted
+    bool next(LatencySample& sample);
+    uint16_t getCount() const { return count; }
+  };
+  
+private:
+  uint16_t* records;
+  uint16_t capacity;
+  uint16_t head;          // index of the oldest record
+  uint16_t count;
+  uint16_t baseLatency;   // decoded latency chain value at the oldest record
+  uint16_t lastLatency;   // decoded latency chain value at the newest record
+  mutable portMUX_TYPE lock;
+  
+public:
+  LatencyHistory();
+  
+  // Bind to preallocated storage, clears the history
+  void attach(uint16_t* storage, uint16_t capacity);
+  void clear();
+  
+  // Append one result, evicting the oldest when full
+  void record(Status status, uint16_t latency);
+  
+  uint16_t getCount() const { return count; }
+  uint16_t getCapacity() const { return capacity; }
+  
+  // Copies the newest samples (at most size) into buffer, safe from any task
+  Cursor snapshot(uint16_t* buffer, uint16_t size) const;
+  
+private:
+  void append(Status status, uint16_t latency);
+  static uint16_t encode(Status status, int16_t delta);
+  static Status decodeStatus(uint16_t record) { return (Status)(record >> 14); }
+  static int16_t decodeDelta(uint16_t record);
+};
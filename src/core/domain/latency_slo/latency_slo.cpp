@@ -0,0 +1,111 @@
+#include "core/domain/latency_slo/latency_slo.h"
+#include "core/infrastructure/logger/logger.h"
+
+const uint16_t LatencySlo::BUCKET_BOUNDS[BUCKET_COUNT] = {
+  25, 50, 75, 100, 150, 200, 300, 400, 500, 750, 1000, 1500, 2000, 3000, 5000, 65535
+};
+
+LatencySlo::LatencySlo() : sloMs(0), sustainMs(0) {
+  configure(0, 0);
+}
+
+void LatencySlo::configure(uint16_t sloMs, uint32_t sustainMs) {
+  this->sloMs = sloMs;
+  this->sustainMs = sustainMs;
+  
+  memset(samples, 0, sizeof(samples));
+  memset(bucketCounts, 0, sizeof(bucketCounts));
+  head = 0;
+  count = 0;
+  overSloCount = 0;
+  degraded = false;
+  changeStartTime = 0;
+  degradedSince = 0;
+  pendingTransition = SloTransition::NONE;
+}
+
+uint8_t LatencySlo::bucketFor(uint16_t latency) {
+  uint8_t bucket = 0;
+  while (bucket < BUCKET_COUNT - 1 && latency > BUCKET_BOUNDS[bucket]) {
+    bucket++;
+  }
+  return bucket;
+}
+
+void LatencySlo::addSample(uint16_t latency) {
+  if (!isEnabled()) return;
+  
+  // Evict the oldest sample once the window is full
+  if (count == WINDOW_SIZE) {
+    uint16_t old = samples[head];
+    bucketCounts[bucketFor(old)]--;
+    if (old > sloMs) overSloCount--;
+  } else {
+    count++;
+  }
+  
+  samples[head] = latency;
+  bucketCounts[bucketFor(latency)]++;
+  if (latency > sloMs) overSloCount++;
+  head = (head + 1) % WINDOW_SIZE;
+  
+  // A change in either direction must be sustained before it is reported
+  unsigned long now = millis();
+  bool breached = isBreached();
+  if (breached == degraded) {
+    changeStartTime = 0;
+  } else {
+    if (changeStartTime == 0) {
+      changeStartTime = now;
+    }
+    if (now - changeStartTime >= sustainMs) {
+      degraded = breached;
+      if (degraded) {
+        degradedSince = changeStartTime;
+      }
+      pendingTransition = degraded ? SloTransition::DEGRADED : SloTransition::RESTORED;
+      changeStartTime = 0;
+    }
+  }
+}
+
+bool LatencySlo::isBreached() const {
+  // Only judge a full window, a handful of slow samples at boot is noise
+  if (count < WINDOW_SIZE) return false;
+  
+  // p95 is the ceil(0.95 * n)-th smallest sample: it exceeds the SLO
+  // when at least n - ceil(0.95 * n) + 1 samples do
+  uint8_t rank = (count * 95 + 99) / 100;
+  return overSloCount >= count - rank + 1;
+}
+
+uint16_t LatencySlo::getP95() const {
+  if (count == 0) return 0;
+  
+  // Estimate from the histogram: upper bound of the bucket holding the p95 rank
+  uint8_t rank = (count * 95 + 99) / 100;
+  uint8_t cumulative = 0;
+  for (uint8_t i = 0; i < BUCKET_COUNT - 1; i++) {
+    cumulative += bucketCounts[i];
+    if (cumulative >= rank) {
+      return BUCKET_BOUNDS[i];
+    }
+  }
+  
+  // Open-ended last bucket: report the slowest sample instead of the bound
+  uint16_t slowest = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (samples[i] > slowest) slowest = samples[i];
+  }
+  return slowest;
+}
+
+unsigned long LatencySlo::getDegradedDuration() const {
+  return degradedSince > 0 ? (millis() - degradedSince) / 1000 : 0;
+}
+
+SloTransition LatencySlo::takeTransition() {
+  SloTransition transition = pendingTransition;
+  pendingTransition = SloTransition::NONE;
+  return transition;
+}
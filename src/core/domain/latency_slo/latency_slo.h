@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+
+// Latency SLO state transitions reported once to the alert layer
+enum class SloTransition : uint8_t {
+  NONE,
+  DEGRADED,
+  RESTORED
+};
+
+/**
+ * @brief Rolling p95 latency tracker with SLO breach detection
+ * 
+ * Keeps the last WINDOW_SIZE successful latencies in a ring plus a small
+ * histogram, both updated incrementally. The breach test needs no sort:
+ * p95 exceeds the SLO exactly when more than 5% of the window is above it,
+ * so only a running over-SLO count is compared per sample. Degradation and
+ * restoration must both hold for the sustain window before being reported.
+ */
+class LatencySlo {
+public:
+  static const uint8_t WINDOW_SIZE = 20;
+  static const uint8_t BUCKET_COUNT = 16;
+  
+private:
+  // Histogram bucket upper bounds (ms), last bucket catches everything else
+  static const uint16_t BUCKET_BOUNDS[BUCKET_COUNT];
+  
+  uint16_t sloMs;           // 0 = disabled
+  uint32_t sustainMs;
+  
+  uint16_t samples[WINDOW_SIZE];
+  uint8_t bucketCounts[BUCKET_COUNT];
+  uint8_t head;
+  uint8_t count;
+  uint8_t overSloCount;
+  
+  bool degraded;
+  unsigned long changeStartTime;   // when the breach state started to differ from `degraded`
+  unsigned long degradedSince;
+  SloTransition pendingTransition;
+  
+public:
+  LatencySlo();
+  
+  // Configuration (resets the window)
+  void configure(uint16_t sloMs, uint32_t sustainMs);
+  bool isEnabled() const { return sloMs > 0; }
+  
+  // Record one successful probe latency, O(1)
+  void addSample(uint16_t latency);
+  
+  // Queries
+  bool isBreached() const;
+  bool isDegraded() const { return degraded; }
+  uint16_t getP95() const;
+  uint16_t getSloMs() const { return sloMs; }
+  unsigned long getDegradedDuration() const;
+  SloTransition takeTransition();
+  
+private:
+  static uint8_t bucketFor(uint16_t latency);
+};
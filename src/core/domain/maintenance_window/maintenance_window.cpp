@@ -0,0 +1,173 @@
+#include "core/domain/maintenance_window/maintenance_window.h"
+
+MaintenanceSchedule::MaintenanceSchedule() {
+  clear();
+}
+
+void MaintenanceSchedule::clear() {
+  windowCount = 0;
+  active = false;
+  compiledAt = 0;
+  nextTransitionAt = 0;
+}
+
+bool MaintenanceSchedule::parse(const String& spec) {
+  clear();
+  
+  int start = 0;
+  while (start < (int)spec.length()) {
+    int end = spec.indexOf(';', start);
+    if (end == -1) end = spec.length();
+    
+    String part = spec.substring(start, end);
+    part.trim();
+    start = end + 1;
+    if (part.length() == 0) continue;
+    
+    if (windowCount >= MAX_WINDOWS || !parseWindow(part, windows[windowCount])) {
+      windowCount = 0;
+      return false;
+    }
+    windowCount++;
+  }
+  
+  return true;
+}
+
+bool MaintenanceSchedule::parseWindow(const String& spec, MaintenanceWindow& window) {
+  // MIN HOUR DOW DURATION
+  String fields[4];
+  int fieldCount = 0;
+  int pos = 0;
+  while (pos < (int)spec.length() && fieldCount < 4) {
+    while (pos < (int)spec.length() && spec.charAt(pos) == ' ') pos++;
+    int end = spec.indexOf(' ', pos);
+    if (end == -1) end = spec.length();
+    if (end > pos) {
+      fields[fieldCount++] = spec.substring(pos, end);
+    }
+    pos = end;
+  }
+  if (fieldCount != 4) return false;
+  
+  long minute, hour, duration;
+  if (!parseNumber(fields[0], 0, 59, minute) || !parseNumber(fields[1], 0, 23, hour) ||
+      !parseNumber(fields[3], 1, 1440, duration)) {
+    return false;
+  }
+  
+  window.startMinute = hour * 60 + minute;
+  window.durationMinutes = duration;
+  return parseDays(fields[2], window.dayMask);
+}
+
+bool MaintenanceSchedule::parseDays(const String& spec, uint8_t& mask) {
+  if (spec == "*") {
+    mask = 0x7F;
+    return true;
+  }
+  
+  mask = 0;
+  int start = 0;
+  while (start < (int)spec.length()) {
+    int end = spec.indexOf(',', start);
+    if (end == -1) end = spec.length();
+    String item = spec.substring(start, end);
+    start = end + 1;
+    
+    // "x", "1-5": any other token ("", "1-", "mon", "9") rejects the whole window
+    int dash = item.indexOf('-');
+    long first, last;
+    if (!parseNumber(dash == -1 ? item : item.substring(0, dash), 0, 6, first)) return false;
+    if (dash == -1) {
+      last = first;
+    } else if (!parseNumber(item.substring(dash + 1), first, 6, last)) {
+      return false;
+    }
+    
+    for (long day = first; day <= last; day++) {
+      mask |= 1 << day;
+    }
+  }
+  
+  return mask != 0;
+}
+
+bool MaintenanceSchedule::parseNumber(const String& text, long minValue, long maxValue, long& value) {
+  // Digits only: toInt() would read "abc" as 0 and "3x" as 3
+  if (text.length() == 0 || text.length() > 4) return false;
+  for (unsigned int i = 0; i < text.length(); i++) {
+    if (text[i] < '0' || text[i] > '9') return false;
+  }
+  value = text.toInt();
+  return value >= minValue && value <= maxValue;
+}
+
+bool MaintenanceSchedule::isActive(uint32_t now) {
+  if (windowCount == 0 || now == 0) return false;
+  
+  // Clock stepped backwards or transition reached: rebuild the table
+  if (nextTransitionAt == 0 || now >= nextTransitionAt || now < compiledAt) {
+    compile(now);
+  }
+  return active;
+}
+
+void MaintenanceSchedule::compile(uint32_t now) {
+  // Windows last at most a day, so yesterday's occurrences can still cover now
+  // and the next start is at most a week away
+  static const int FIRST_DAY = -1;
+  static const int LAST_DAY = 7;
+  static const int MAX_OCCURRENCES = MAX_WINDOWS * (LAST_DAY - FIRST_DAY + 1);
+  
+  uint32_t starts[MAX_OCCURRENCES];
+  uint32_t ends[MAX_OCCURRENCES];
+  int occurrences = 0;
+  
+  uint32_t today = now / 86400;
+  for (int d = FIRST_DAY; d <= LAST_DAY; d++) {
+    uint32_t day = today + d;
+    uint8_t weekday = (day + 4) % 7;   // 1970-01-01 was a Thursday
+    for (uint8_t w = 0; w < windowCount; w++) {
+      if (!(windows[w].dayMask & (1 << weekday))) continue;
+      starts[occurrences] = day * 86400 + windows[w].startMinute * 60;
+      ends[occurrences] = starts[occurrences] + windows[w].durationMinutes * 60;
+      occurrences++;
+    }
+  }
+  
+  active = false;
+  uint32_t next = now + 7 * 86400;
+  
+  uint32_t activeEnd = 0;
+  for (int i = 0; i < occurrences; i++) {
+    if (starts[i] <= now && now < ends[i] && ends[i] > activeEnd) {
+      activeEnd = ends[i];
+    }
+  }
+  
+  if (activeEnd > 0) {
+    // Overlapping or back-to-back windows merge into one maintenance period
+    active = true;
+    bool extended = true;
+    while (extended) {
+      extended = false;
+      for (int i = 0; i < occurrences; i++) {
+        if (starts[i] <= activeEnd && ends[i] > activeEnd) {
+          activeEnd = ends[i];
+          extended = true;
+        }
+      }
+    }
+    next = activeEnd;
+  } else {
+    for (int i = 0; i < occurrences; i++) {
+      if (starts[i] > now && starts[i] < next) {
+        next = starts[i];
+      }
+    }
+  }
+  
+  compiledAt = now;
+  nextTransitionAt = next;
+}
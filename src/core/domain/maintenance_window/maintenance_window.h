@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+
+// One recurring window: weekday mask + local start time + duration
+struct MaintenanceWindow {
+  uint8_t dayMask;            // bit 0 = Sunday ... bit 6 = Saturday
+  uint16_t startMinute;       // minutes after local midnight
+  uint16_t durationMinutes;   // 1..1440
+};
+
+/**
+ * @brief Per-target planned maintenance schedule
+ * 
+ * Parsed from a cron-like option: `maint=MIN HOUR DOW DURATION_MIN`,
+ * several windows separated by ';' (e.g. `maint=0 3 * 60;30 22 6 240`).
+ * DOW accepts `*`, single days (0-6, 0 = Sunday) and lists/ranges such as
+ * `1-5` or `0,6`; any other field (7, "mon", "1-") rejects the option.
+ * 
+ * The windows are compiled into one pending transition (active flag and the
+ * epoch second it next changes), so the per-probe check is a single
+ * timestamp compare. The table is recompiled only when that moment passes.
+ */
+class MaintenanceSchedule {
+public:
+  static const uint8_t MAX_WINDOWS = 4;
+  
+private:
+  MaintenanceWindow windows[MAX_WINDOWS];
+  uint8_t windowCount;
+  
+  // Compiled transition table
+  bool active;
+  uint32_t compiledAt;
+  uint32_t nextTransitionAt;   // 0 = not compiled yet
+  
+public:
+  MaintenanceSchedule();
+  
+  // Parse the option value, returns false (and keeps no windows) on syntax errors
+  bool parse(const String& spec);
+  void clear();
+  bool hasWindows() const { return windowCount > 0; }
+  uint8_t getWindowCount() const { return windowCount; }
+  
+  // Hot path: now = local epoch seconds (0 = clock unknown, never in maintenance)
+  bool isActive(uint32_t now);
+  
+  // State as of the last isActive() call
+  bool isInWindow() const { return active; }
+  uint32_t getNextTransition() const { return nextTransitionAt; }
+  
+private:
+  void compile(uint32_t now);
+  static bool parseWindow(const String& spec, MaintenanceWindow& window);
+  static bool parseDays(const String& spec, uint8_t& mask);
+  static bool parseNumber(const String& text, long minValue, long maxValue, long& value);
+};
@@ -1,13 +1,90 @@
 #include "core/domain/network_monitor/network_monitor.h"
 #include "config/config_loader/config_loader.h"
 #include "core/infrastructure/memory_manager/memory_manager.h"
+#include "core/infrastructure/notification_dispatcher/notification_dispatcher.h"
+#include "core/infrastructure/async_probe/async_probe.h"
+#include "core/infrastructure/ntp_service/ntp_service.h"
 #include <Arduino.h>
 #include "core/infrastructure/logger/logger.h"
+#include <SPIFFS.h>
+
+// SLA checkpoint file layout: header, then one record per target
+static const char* SLA_CHECKPOINT_PATH = "/sla.bin";
+static const char* SLA_CHECKPOINT_TEMP_PATH = "/sla.tmp";
+static const uint32_t SLA_CHECKPOINT_MAGIC = 0x534C4131; // "SLA1"
+
+// Longest alert/recovery cooldown accepted from config.env (one day)
+static const long MAX_POLICY_COOLDOWN_MS = 86400000L;
+
+// Logs and rejects an alert policy value outside [minValue, maxValue] (index -1 = global setting)
+static bool policyInRange(int index, const char* name, long value, long minValue, long maxValue) {
+  if (value >= minValue && value <= maxValue) return true;
+  if (index < 0) {
+    Serial_printf("[NETWORK_MONITOR] WARNING: %s=%ld outside %ld..%ld, default kept\n", name, value, minValue, maxValue);
+  } else {
+    Serial_printf("[NETWORK_MONITOR] WARNING: Target %d %s=%ld outside %ld..%ld, global value kept\n",
+                 index + 1, name, value, minValue, maxValue);
+  }
+  return false;
+}
+
+// Plain decimal only: "abc" would read as 0 and "-1" would wrap in a uint8_t field
+static bool parsePolicyNumber(const String& text, long& value) {
+  if (text.length() == 0 || text.length() > 9) return false;
+  for (unsigned int i = 0; i < text.length(); i++) {
+    if (text[i] < '0' || text[i] > '9') return false;
+  }
+  value = text.toInt();
+  return true;
+}
+
+// Per-target option, false if absent or not a number (logged)
+static bool readPolicyOption(int index, const char* name, long& value) {
+  String text = ConfigLoader::getTargetOption(index, name);
+  if (text.length() == 0) return false;
+  if (parsePolicyNumber(text, value)) return true;
+  Serial_printf("[NETWORK_MONITOR] WARNING: Target %d %s=%s is not a number, global value kept\n",
+               index + 1, name, text.c_str());
+  return false;
+}
+
+// Per-target "a/b" option (window=, flap=), false if absent or malformed (logged)
+static bool readPolicyPair(int index, const char* name, long& first, long& second) {
+  String text = ConfigLoader::getTargetOption(index, name);
+  if (text.length() == 0) return false;
+  int slash = text.indexOf('/');
+  if (slash > 0 && parsePolicyNumber(text.substring(0, slash), first) &&
+      parsePolicyNumber(text.substring(slash + 1), second)) {
+    return true;
+  }
+  Serial_printf("[NETWORK_MONITOR] WARNING: Target %d %s=%s is not N/M, global value kept\n",
+               index + 1, name, text.c_str());
+  return false;
+}
+
+struct SlaCheckpointHeader {
+  uint32_t magic;
+  uint16_t recordSize;
+  uint8_t targetCount;
+  uint8_t reserved;
+};
+
+struct SlaCheckpointRecord {
+  uint32_t nameHash;
+  SlaTracker tracker;
+};
 
 NetworkMonitor::NetworkMonitor() 
-  : wifiService(nullptr), httpClient(nullptr), telegramService(nullptr),
-    displayManager(nullptr), taskManager(nullptr), targetCount(0), 
-    scanning(false), lastScanTime(0), scanInterval(30000), initialized(false) {
+  : wifiService(nullptr), httpClient(nullptr),
+    displayManager(nullptr), taskManager(nullptr), snapshotPending(false), targetCount(0), 
+    scanning(false), lastScanTime(0), scanInterval(30000),
+    nextScanSlot(0), pendingTargets(0), inFlightTargets(0), dispatchClosed(false), scansAborted(0), coalescedResults(0), skippedProbes(0), minProbeFreeHeap(UINT32_MAX),
+    stalenessBound(60000), starvedTargets(0),
+    slaCheckpointInterval(0), lastSlaCheckpoint(0), maintenanceProbeInterval(300000), initialized(false) {
+  // Carve the history arena into fixed per-target rings once
+  for (int i = 0; i < 10; i++) {
+    history[i].attach(&historyArena[i * HISTORY_DEPTH], HISTORY_DEPTH);
+  }
 }
 
 NetworkMonitor::~NetworkMonitor() {
@@ -32,25 +109,37 @@ bool NetworkMonitor::initialize() {
     wifiService->initialize(ssid, password);
   }
   
-  // Initialize Telegram service
-  if (telegramService) {
-    String botToken = ConfigLoader::getTelegramBotToken();
-    String chatId = ConfigLoader::getTelegramChatId();
-    bool enabled = ConfigLoader::isTelegramEnabled();
-    telegramService->initialize(botToken, chatId, enabled);
+  scanInterval = ConfigLoader::getScanIntervalMs();
+  if (scanInterval < 5000) {
+    scanInterval = 5000;
   }
   
+  // Every target must have a result at most this old (default: two intervals)
+  stalenessBound = ConfigLoader::getStalenessBoundMs();
+  if (stalenessBound < scanInterval) {
+    stalenessBound = 2 * scanInterval;
+  }
+  maintenanceProbeInterval = ConfigLoader::getMaintenanceProbeIntervalMs();
+  
+  // Resume availability history from the last checkpoint
+  slaCheckpointInterval = ConfigLoader::getSlaCheckpointIntervalMs();
+  lastSlaCheckpoint = millis();
+  restoreSlaCheckpoint();
+  
+  // Probes overlap on the worker pool; without it they run on the scanner task
+  ProbeWorkerPool::initialize(ConfigLoader::getProbeWorkerCount(), runProbeOnWorker, this);
+  // Plain HTTP pings don't need a worker's stack, they run as state machines here (sockets left after the workers)
+  AsyncProbePool::initialize(ConfigLoader::getAsyncProbeSlots());
+  
   initialized = true;
   Serial_printf("[NETWORK_MONITOR] Initialized with %d targets\n", targetCount);
   
   return true;
 }
 
-void NetworkMonitor::setDependencies(WiFiService* wifi, HttpClient* http, TelegramService* telegram, 
-                                    DisplayManager* display, TaskManager* tasks) {
+void NetworkMonitor::setDependencies(WiFiService* wifi, HttpClient* http, DisplayManager* display, TaskManager* tasks) {
   wifiService = wifi;
   httpClient = http;
-  telegramService = telegram;
   displayManager = display;
   taskManager = tasks;
 }
@@ -63,15 +152,25 @@ void NetworkMonitor::update() {
     wifiService->update();
   }
   
-  // Check if it's time to scan
+  // Multiplexed probes advance and results from the probe workers are applied
+  // here, on the scanner task
+  AsyncProbePool::poll();
+  collectProbeResults();
+  collectDeliveryReceipts();
+  
+  if (snapshotPending) {
+    publishSnapshot();
+  }
+  
+  // Check if it's time to start a new cycle
   unsigned long now = millis();
-  if (now - lastScanTime >= scanInterval) {
+  if (!scanning && now - lastScanTime >= scanInterval) {
     startScanning();
   }
   
-  // Process any ongoing scan
+  // Dispatch whichever probe is due in the running cycle
   if (scanning) {
-    processScanResults();
+    dispatchDueProbe();
   }
 }
 
@@ -84,57 +183,199 @@ void NetworkMonitor::startScanning() {
   scanning = true;
   lastScanTime = millis();
   scanStartTime = millis();
+  nextScanSlot = 0;
+  pendingTargets = 0;
+  dispatchClosed = false;
+  for (int i = 0; i < targetCount; i++) {
+    // Coalesced targets get their result from the group leader; a probe still
+    // running from a force-stopped cycle is not submitted twice
+    if (probeLeader[i] == i && !(inFlightTargets & (1 << i))) {
+      pendingTargets |= 1 << i;
+    }
+  }
+  cycleDnsStart = DnsCache::getStats();
   
-  Serial_println("[NETWORK_MONITOR] Starting scan cycle...");
+  Serial_printf("[NETWORK_MONITOR] Starting scan cycle (%d targets over %lums)...\n", targetCount, scanInterval);
   
   // Notify display that scan started
-  if (displayManager) {
-    displayManager->onScanStarted();
-  }
+  ScanEvent event = {EV_SCAN_START, -1, UNKNOWN, 0};
+  TaskManager::sendEvent(event);
+}
+
+unsigned long NetworkMonitor::getProbeOffset(int slot) const {
+  // Slots are spread evenly over the interval, in dependency order, so
+  // TLS handshakes (heap) and radio bursts never pile up at cycle start
+  return targetCount > 0 ? (unsigned long)((uint64_t)slot * scanInterval / targetCount) : 0;
+}
+
+long NetworkMonitor::getStalenessSlack(int index, unsigned long now) const {
+  // Time left before this target's result would exceed the staleness bound,
+  // if it were probed now and took its usual time
+  long staleness = lastResultTime[index] > 0 ? (long)(now - lastResultTime[index]) : (long)stalenessBound;
+  return (long)stalenessBound - staleness - (long)expectedCost[index];
+}
+
+int NetworkMonitor::selectNextTarget(unsigned long elapsed) {
+  unsigned long now = millis();
+  unsigned long budget = elapsed < scanInterval ? scanInterval - elapsed : 0;
+  int best = -1;
+  long bestSlack = 0;
   
-  // Scan all targets with timeout protection
-  for (int i = 0; i < targetCount; i++) {
-    unsigned long targetStartTime = millis();
+  // Earliest deadline first; scanOrder breaks ties in dependency order
+  for (int n = 0; n < targetCount; n++) {
+    int i = scanOrder[n];
+    if (!(pendingTargets & (1 << i))) continue;
+    
+    // Parents are decided before their children (a coalesced parent by its leader)
+    int parent = targets[i].getParentIndex();
+    if (parent >= 0 && ((pendingTargets | inFlightTargets) & (1 << probeLeader[parent]))) continue;
     
-    // Feed watchdog at start of each target
-    MemoryManager::getInstance().feedWatchdog();
+    long slack = getStalenessSlack(i, now);
+    
+    // Doesn't fit the rest of this cycle and can afford to wait for the next one
+    if (expectedCost[i] > budget && slack > (long)scanInterval) {
+      Serial_printf("[NETWORK_MONITOR] Deferring %s to next cycle (expected %ums, %lums left)\n",
+                   targets[i].getName().c_str(), expectedCost[i], budget);
+      pendingTargets &= ~(1 << i);
+      continue;
+    }
     
-    // Check if scan is taking too long (30 seconds max per scan)
-    if (millis() - scanStartTime > 30000) {
-      Serial_println("[NETWORK_MONITOR] WARNING: Scan timeout, stopping remaining targets");
+    if (best < 0 || slack < bestSlack) {
+      best = i;
+      bestSlack = slack;
+    }
+  }
+  
+  return best;
+}
+
+void NetworkMonitor::dispatchDueProbe() {
+  // At most one real probe per call keeps the scanner task responsive
+  while (!dispatchClosed && pendingTargets != 0) {
+    unsigned long elapsed = millis() - scanStartTime;
+    if (elapsed < getProbeOffset(nextScanSlot)) {
+      return;
+    }
+    
+    // Out of time: whatever is left is carried over and goes first next cycle
+    if (elapsed > scanInterval) {
+      dispatchClosed = true;
       break;
     }
     
     // Check memory before each target
     if (MemoryManager::getInstance().isMemoryCritical()) {
       Serial_println("[NETWORK_MONITOR] WARNING: Critical memory, stopping scan");
+      scansAborted++;
+      dispatchClosed = true;
       break;
     }
     
-    scanTarget(i);
+    int i = selectNextTarget(elapsed);
+    if (i < 0) {
+      // Remaining targets wait for a parent still being probed
+      if (inFlightTargets != 0) return;
+      break;
+    }
+    pendingTargets &= ~(1 << i);
     
-    // Feed watchdog after each target
-    MemoryManager::getInstance().feedWatchdog();
+    // Planned maintenance: probe at a reduced rate, results never alert
+    if (!isGroupProbeDue(i)) {
+      continue;
+    }
     
-    // Check if this target took too long (10 seconds max per target)
-    unsigned long targetDuration = millis() - targetStartTime;
-    if (targetDuration > 10000) {
-      Serial_printf("[NETWORK_MONITOR] WARNING: Target %d took %lums (too long)\n", i, targetDuration);
+    // Don't burn a full timeout on targets behind a failed parent
+    if (isParentDown(i)) {
+      Serial_printf("[NETWORK_MONITOR] Skipping %s: parent %s is down\n", targets[i].getName().c_str(),
+                   targets[targets[i].getParentIndex()].getName().c_str());
+      updateTargetStatus(i, UNREACHABLE, 0);
+      fanOutResult(i);
+      continue;
     }
     
-    delay(200); // Small delay between targets
+    unsigned long targetStartTime = millis();
+    if (lastResultTime[i] > 0 && targetStartTime - lastResultTime[i] > stalenessBound) {
+      starvationCount[i]++;
+      Serial_printf("[NETWORK_MONITOR] WARNING: %s result was %lums old (bound %lums)\n",
+                   targets[i].getName().c_str(), targetStartTime - lastResultTime[i], stalenessBound);
+    }
+    
+    nextScanSlot++;
+    if (targets[i].getMonitorType() == PING && AsyncProbePool::submit(i, targets[i].getUrl())) {
+      inFlightTargets |= 1 << i;
+    } else if (ProbeWorkerPool::submit(i)) {
+      inFlightTargets |= 1 << i;
+    } else {
+      // Pool disabled (or its queue full): probe right here
+      scanTarget(i);
+    }
+    
+    if (pendingTargets != 0) {
+      return;
+    }
   }
   
+  // The cycle ends once every submitted probe has reported back
+  if (inFlightTargets == 0) {
+    finishScan();
+  }
+}
+
+void NetworkMonitor::collectProbeResults() {
+  ProbeResult result;
+  while (ProbeWorkerPool::takeResult(result) || AsyncProbePool::takeResult(result)) {
+    inFlightTargets &= ~(1 << result.targetIndex);
+    if (result.skipped) {
+      requeueProbe(result.targetIndex);
+    } else {
+      applyProbeResult(result.targetIndex, result.latency, result.durationMs);
+    }
+  }
+}
+
+void NetworkMonitor::finishScan() {
   // Mark scan as complete
   scanning = false;
   
   lastScanDuration = millis() - scanStartTime;
-  Serial_printf("[NETWORK_MONITOR] Scan cycle complete in %lums\n", lastScanDuration);
   
-  // Notify display that scan completed
-  if (displayManager) {
-    displayManager->onScanCompleted();
+  // Targets left unprobed carry over; only those past the bound are starved
+  int carried = 0;
+  starvedTargets = 0;
+  unsigned long now = millis();
+  for (int i = 0; i < targetCount; i++) {
+    if (pendingTargets & (1 << i)) carried++;
+    if (!maintenance[i].isInWindow() && lastResultTime[i] > 0 && now - lastResultTime[i] > stalenessBound) {
+      starvedTargets++;
+    }
+  }
+  pendingTargets = 0;
+  
+  Serial_printf("[NETWORK_MONITOR] Scan cycle complete in %lums (%d carried over, %d starved)\n",
+               lastScanDuration, carried, starvedTargets);
+  
+  // Cache effect on this cycle: answers served locally x average network lookup
+  DnsCache::Stats dns = DnsCache::getStats();
+  uint32_t dnsLookups = dns.lookups - cycleDnsStart.lookups;
+  uint32_t dnsAnswered = (dns.hits - cycleDnsStart.hits) + (dns.negativeHits - cycleDnsStart.negativeHits);
+  if (dnsLookups > 0) {
+    Serial_printf("[NETWORK_MONITOR] DNS: %lu/%lu from cache, ~%lums saved this cycle\n",
+                 (unsigned long)dnsAnswered, (unsigned long)dnsLookups,
+                 (unsigned long)(dnsAnswered * DnsCache::getAverageResolveMs()));
   }
+  
+  snapshot.lastScanDuration = lastScanDuration;
+  publishSnapshot();
+  
+  // Flash writes are rate-limited, at most one checkpoint per interval
+  if (slaCheckpointInterval > 0 && millis() - lastSlaCheckpoint >= slaCheckpointInterval) {
+    saveSlaCheckpoint();
+    lastSlaCheckpoint = millis();
+  }
+  
+  // Notify display that scan completed
+  ScanEvent event = {EV_SCAN_COMPLETE, -1, UNKNOWN, 0};
+  TaskManager::sendEvent(event);
 }
 
 void NetworkMonitor::stopScanning() {
@@ -155,6 +396,23 @@ bool NetworkMonitor::loadTargets() {
     targets[3] = Target("Polaris API", "https://pet-chem-independence-australia.trycloudflare.com", "/health", HEALTH_CHECK);
     targets[4] = Target("Polaris INT", "http://ebfc52323306.ngrok-free.app", "/health", PING);
     targets[5] = Target("Polaris WEB", "https://tech-tweakers.github.io/polaris-v2-web", "", PING);
+    for (int i = 0; i < targetCount; i++) {
+      alerts[i] = Alert(i, targets[i].getName());
+      alerts[i].setPolicy(loadAlertPolicy(-1));
+      latencySlo[i].configure(0, 0);
+      slaTrackers[i].clear();
+      history[i].clear();
+      maintenance[i].clear();
+      validators[i].clear();
+      conditionalGet[i] = ConfigLoader::isConditionalGetEnabled();
+      lastProbeTime[i] = 0;
+      lastResultTime[i] = 0;
+      expectedCost[i] = 1000;
+      starvationCount[i] = 0;
+    }
+    resolveDependencies();
+    resolveProbeGroups();
+    resetSnapshot();
     return true;
   }
   
@@ -170,6 +428,19 @@ bool NetworkMonitor::loadTargets() {
     targets[i] = Target(name, url, healthEndpoint, type);
     targets[i].setStatus(UNKNOWN);
     targets[i].setLatency(0);
+    alerts[i] = Alert(i, name);
+    alerts[i].setPolicy(loadAlertPolicy(i));
+    loadLatencySlo(i);
+    slaTrackers[i].clear();
+    history[i].clear();
+    loadMaintenance(i);
+    validators[i].clear();
+    conditionalGet[i] = ConfigLoader::getTargetOption(i, "conditional",
+                                                      ConfigLoader::isConditionalGetEnabled() ? "true" : "false").equalsIgnoreCase("true");
+    lastProbeTime[i] = 0;
+    lastResultTime[i] = 0;
+    expectedCost[i] = 1000;
+    starvationCount[i] = 0;
     
     Serial_printf("[NETWORK_MONITOR] Target %d: %s | %s | %s | %s\n", 
                  i + 1, name.c_str(), url.c_str(), 
@@ -177,6 +448,9 @@ bool NetworkMonitor::loadTargets() {
                  monitorTypeStr.c_str());
   }
   
+  resolveDependencies();
+  resolveProbeGroups();
+  resetSnapshot();
   return true;
 }
 
@@ -186,69 +460,105 @@ void NetworkMonitor::scanTarget(int index) {
     return;
   }
   
-  Target& target = targets[index];
   unsigned long targetStartTime = millis();
+  uint16_t latency = runProbe(index, *httpClient);
+  if (httpClient->wasSkipped()) {
+    requeueProbe(index);
+    return;
+  }
+  applyProbeResult(index, latency, millis() - targetStartTime);
+}
+
+void NetworkMonitor::requeueProbe(int index) {
+  // The device had no TLS slot free: keep the previous status and try again
+  // at a later slot; once the cycle closes it carries over like any other
+  skippedProbes++;
+  Serial_printf("[NETWORK_MONITOR] %s not probed (no TLS slot), requeued\n", targets[index].getName().c_str());
+  if (scanning && !dispatchClosed) {
+    pendingTargets |= 1 << index;
+  }
+}
+
+uint16_t NetworkMonitor::runProbeOnWorker(void* context, int index, HttpClient& client) {
+  return static_cast<NetworkMonitor*>(context)->runProbe(index, client);
+}
+
+uint16_t NetworkMonitor::runProbe(int index, HttpClient& client) {
+  // May run on a probe worker: reads only the target's (immutable) address and
+  // its validators, which belong to this probe while it is in flight
+  const Target& target = targets[index];
   
-  // Optimized string handling
-  const char* name = target.getName().c_str();
+  // getName() returns a copy, keep it alive while logging
+  String nameCopy = target.getName();
+  const char* name = nameCopy.c_str();
   const char* typeStr = (target.getMonitorType() == HEALTH_CHECK) ? "HEALTH_CHECK" : "PING";
   
   Serial_printf("[NETWORK_MONITOR] Checking %s (type: %s)...\n", name, typeStr);
   
-  uint16_t latency = 0;
-  
   // Check memory before proceeding
   if (MemoryManager::getInstance().isMemoryCritical()) {
     Serial_println("[NETWORK_MONITOR] ERROR: Critical memory, skipping target");
-    updateTargetStatus(index, DOWN, 0);
-    return;
+    return 0;
   }
   
   // Reduced delay for better performance
   vTaskDelay(pdMS_TO_TICKS(50));
   
-  // Feed watchdog before HTTP request
-  MemoryManager::getInstance().feedWatchdog();
-  
   // Timeout de 10s para conexões lentas, mas evita travamentos
   uint16_t timeout = 10000;
   
-  // Perform the check with timeout protection
+  uint16_t latency;
   if (target.getMonitorType() == HEALTH_CHECK) {
-    // Use enhanced health check with timeout
-    latency = performSafeHealthCheck(target.getUrl(), target.getHealthEndpoint(), timeout);
+    // Health check with intelligent timeout and body validation
+    latency = runHealthCheck(client, target.getUrl(), target.getHealthEndpoint(), getValidators(index));
   } else {
     // Enhanced ping with timeout
-    latency = httpClient->ping(target.getUrl(), timeout);
+    latency = client.ping(target.getUrl(), timeout, getValidators(index));
   }
   
-  // Feed watchdog after HTTP request
-  MemoryManager::getInstance().feedWatchdog();
+  return latency;
+}
+
+void NetworkMonitor::applyProbeResult(int index, uint16_t latency, unsigned long durationMs) {
+  String nameCopy = targets[index].getName();
+  const char* name = nameCopy.c_str();
   
   // Check if this target took too long
-  unsigned long targetDuration = millis() - targetStartTime;
-  if (targetDuration > 11000) { // 11s = timeout + margem
-    Serial_printf("[NETWORK_MONITOR] WARNING: Target %s took %lums (timeout)\n", name, targetDuration);
+  if (durationMs > 11000) { // 11s = timeout + margem
+    Serial_printf("[NETWORK_MONITOR] WARNING: Target %s took %lums (timeout)\n", name, durationMs);
   }
   
   // Fixed strategy: timeout and failures should be DOWN for proper alerting
   Status newStatus;
   if (latency > 0) {
     newStatus = UP;
-  } else if (targetDuration > 11000) {
+  } else if (durationMs > 11000) {
     // CRITICAL FIX: Timeout should be DOWN to trigger alerts, not UNKNOWN
     newStatus = DOWN;
-    Serial_printf("[NETWORK_MONITOR] Target %s marked as DOWN due to timeout (%lums)\n", name, targetDuration);
+    Serial_printf("[NETWORK_MONITOR] Target %s marked as DOWN due to timeout (%lums)\n", name, durationMs);
   } else {
     newStatus = DOWN;
   }
   
   updateTargetStatus(index, newStatus, latency);
+  lastProbeTime[index] = millis();
+  fanOutResult(index);
+  
+  // Expected cost follows the observed probe duration (timeouts included)
+  uint32_t cost = durationMs > 0xFFFF ? 0xFFFF : durationMs;
+  expectedCost[index] = (uint16_t)((expectedCost[index] * 3 + cost) / 4);
+  
+  uint32_t freeHeap = ESP.getFreeHeap();
+  if (freeHeap < minProbeFreeHeap) {
+    minProbeFreeHeap = freeHeap;
+  }
 }
 
 void NetworkMonitor::updateTargetStatus(int index, Status status, uint16_t latency) {
   if (index < 0 || index >= targetCount) return;
   
+  lastResultTime[index] = millis();
+  
   Target& target = targets[index];
   target.setStatus(status);
   target.setLatency(latency);
@@ -258,23 +568,179 @@ void NetworkMonitor::updateTargetStatus(int index, Status status, uint16_t laten
                target.getStatusText().c_str(), 
                latency);
   
-  // Notify Telegram service
-  if (telegramService) {
-    telegramService->updateTargetStatus(index, status, latency, target.getName());
+  // Planned maintenance is shown but neither alerts nor counts against availability
+  if (!maintenance[index].isInWindow()) {
+    // Evaluate alert state, deliveries happen on the notification task
+    evaluateAlert(index, status, latency);
+    recordSla(index, status, latency);
   }
+  history[index].record(status, latency);
+  
+  // Publish for read-only consumers (chat commands)
+  updateSnapshot(index);
   
   // Notify display
   notifyDisplayUpdate(index, status, latency);
 }
 
-void NetworkMonitor::processScanResults() {
-  // This method can be used for post-processing scan results
-  // For now, it's handled in updateTargetStatus
+void NetworkMonitor::evaluateAlert(int index, Status status, uint16_t latency) {
+  // Unreachable targets were not probed: their alert state is frozen and
+  // the outage is reported once, by the parent's root-cause alert
+  if (status == UNREACHABLE) {
+    return;
+  }
+  
+  Alert& alert = alerts[index];
+  alert.updateStatus(status, latency);
+  
+  // Flapping targets get one notification per episode instead of alert/recovery storms
+  FlapTransition flap = alert.takeFlapTransition();
+  if (flap != FlapTransition::NONE) {
+    NotificationType type = flap == FlapTransition::STARTED ? NotificationType::FLAP_START : NotificationType::FLAP_END;
+    NotificationEvent event = createEvent(index, type, status, latency);
+    event.downtimeSeconds = alert.getFlapDuration();
+    event.stateChanges = alert.getFlapStateChanges();
+    event.changePercent = alert.getStateChangePercent();
+    raiseNotification(event);
+  }
+  
+  // Latency SLO only looks at successful probes
+  LatencySlo& slo = latencySlo[index];
+  if (status == UP && slo.isEnabled()) {
+    slo.addSample(latency);
+    
+    SloTransition transition = slo.takeTransition();
+    if (transition != SloTransition::NONE) {
+      NotificationType type = transition == SloTransition::DEGRADED ? NotificationType::LATENCY_DEGRADED
+                                                                     : NotificationType::LATENCY_RESTORED;
+      NotificationEvent event = createEvent(index, type, status, slo.getP95());
+      event.thresholdMs = slo.getSloMs();
+      event.downtimeSeconds = slo.getDegradedDuration();
+      raiseNotification(event);
+    }
+  }
+  
+  if (alert.shouldSendAlert()) {
+    NotificationEvent event = createEvent(index, NotificationType::ALERT, status, latency);
+    event.downtimeSeconds = alert.getDowntime();
+    event.firstFailureTime = alert.getFirstFailureTime();
+    event.dependentCount = countUnreachableDependents(index);
+    if (NotificationDispatcher::getChannelCount() == 0) {
+      // No backend to deliver to, the alert state still drives the display
+      alert.markAlertSent();
+    } else if (raiseNotification(event)) {
+      // Marked sent once a backend delivers it, see collectDeliveryReceipts()
+      alert.markAlertQueued();
+    }
+  } else if (alert.shouldSendRecovery()) {
+    // Capture timings before the alert state is cleared
+    NotificationEvent event = createEvent(index, NotificationType::RECOVERY, status, latency);
+    event.downtimeSeconds = alert.getDowntime();
+    event.firstFailureTime = alert.getFirstFailureTime();
+    event.alertStartTime = alert.getAlertDowntimeStart();
+    raiseNotification(event);
+    alert.markRecovered();
+    // Reset alert data for clean state - ready for next alert
+    alert.reset();
+  }
+}
+
+NotificationEvent NetworkMonitor::createEvent(int index, NotificationType type, Status status, uint16_t latency) const {
+  NotificationEvent event;
+  memset(&event, 0, sizeof(event));
+  event.type = type;
+  event.targetIndex = index;
+  event.status = status;
+  event.latency = latency;
+  event.createdAt = millis();
+  strncpy(event.targetName, targets[index].getName().c_str(), sizeof(event.targetName) - 1);
+  return event;
 }
 
-uint16_t NetworkMonitor::performSafeHealthCheck(const String& url, const String& endpoint, uint16_t timeout) {
-  if (!httpClient) return 0;
+bool NetworkMonitor::raiseNotification(const NotificationEvent& event) {
+  if (!NotificationDispatcher::dispatch(event)) {
+    Serial_printf("[NETWORK_MONITOR] No notifier accepted %s event for %s\n",
+                  getNotificationTypeName(event.type), event.targetName);
+    return false;
+  }
+  return true;
+}
+
+void NetworkMonitor::collectDeliveryReceipts() {
+  // An alert nobody delivered stays unsent and is raised again while the target fails
+  NotificationDispatcher::Receipt receipt;
+  while (NotificationDispatcher::takeReceipt(receipt)) {
+    if (receipt.targetIndex < 0 || receipt.targetIndex >= targetCount) continue;
+    
+    Alert& alert = alerts[receipt.targetIndex];
+    if (!alert.isAlertPending()) continue;
+    if (receipt.delivered) {
+      alert.markAlertSent();
+    } else {
+      alert.markAlertUndelivered();
+    }
+  }
+}
+
+void NetworkMonitor::resetSnapshot() {
+  memset(&snapshot, 0, sizeof(snapshot));
+  snapshot.targetCount = targetCount;
   
+  for (int i = 0; i < targetCount; i++) {
+    TargetSnapshot& entry = snapshot.targets[i];
+    strncpy(entry.name, targets[i].getName().c_str(), sizeof(entry.name) - 1);
+    entry.status = UNKNOWN;
+    entry.healthCheck = targets[i].getMonitorType() == HEALTH_CHECK;
+    for (uint8_t w = 0; w < SLA_WINDOW_COUNT; w++) {
+      entry.availability[w] = SLA_NO_DATA;
+    }
+  }
+  
+  publishSnapshot();
+}
+
+void NetworkMonitor::updateSnapshot(int index) {
+  TargetSnapshot& entry = snapshot.targets[index];
+  const Alert& alert = alerts[index];
+  unsigned long now = millis();
+  
+  if (entry.status != targets[index].getStatus() || entry.lastCheckAt == 0) {
+    entry.lastChangeAt = now;
+  }
+  
+  entry.status = targets[index].getStatus();
+  entry.latency = targets[index].getLatency();
+  entry.failureCount = alert.getFailureCount();
+  entry.alertActive = alert.isAlertActive();
+  entry.flapping = alert.isFlapping();
+  entry.p95Latency = latencySlo[index].getP95();
+  entry.latencyDegraded = latencySlo[index].isDegraded();
+  entry.lastCheckAt = now;
+  entry.maintenance = maintenance[index].isInWindow();
+  
+  const SlaTracker& sla = slaTrackers[index];
+  for (uint8_t w = 0; w < SLA_WINDOW_COUNT; w++) {
+    SlaWindow window = (SlaWindow)w;
+    entry.availability[w] = sla.hasData(window) ? sla.getAvailabilityPermille(window) : SLA_NO_DATA;
+    entry.meanLatency[w] = sla.getMeanLatency(window);
+  }
+  
+  publishSnapshot();
+}
+
+void NetworkMonitor::publishSnapshot() {
+  // A reader still pins the back buffer: keep the working copy, update() retries
+  snapshotPending = !StatusSnapshotStore::publish(snapshot);
+}
+
+uint16_t NetworkMonitor::performSafeHealthCheck(const String& url, const String& endpoint, uint16_t timeout,
+                                                HttpValidators* validators) {
+  if (!httpClient) return 0;
+  return runHealthCheck(*httpClient, url, endpoint, validators);
+}
+
+uint16_t NetworkMonitor::runHealthCheck(HttpClient& client, const String& url, const String& endpoint,
+                                        HttpValidators* validators) {
   // Enhanced URL safety checks
   if (url.length() > 200) {
     Serial_println("[NETWORK_MONITOR] ERROR: URL too long for health check");
@@ -284,20 +750,21 @@ uint16_t NetworkMonitor::performSafeHealthCheck(const String& url, const String&
   Serial_printf("[NETWORK_MONITOR] Performing enhanced health check: %s%s\n", url.c_str(), endpoint.c_str());
   
   // Use the enhanced health check with intelligent timeout and retry logic
-  uint16_t latency = httpClient->healthCheck(url, endpoint, 0); // 0 = auto-calculate timeout
+  uint16_t latency = client.healthCheck(url, endpoint, 0, validators); // 0 = auto-calculate timeout
   
   if (latency > 0) {
     // Get the response payload for verification
-    String response = httpClient->getLastResponse();
-    int httpCode = httpClient->getLastHttpCode();
+    String response = client.getLastResponse();
+    int httpCode = client.getLastHttpCode();
     
     if (response.length() > 0 && response.length() < 1000) {
       // Enhanced response validation
-      if (httpClient->isHealthyResponse(response)) {
+      if (client.isHealthyResponse(response)) {
         Serial_printf("[NETWORK_MONITOR] Health check successful: %d ms (HTTP %d)\n", latency, httpCode);
       } else {
         Serial_printf("[NETWORK_MONITOR] Health check FAILED: Unhealthy response detected (HTTP %d)\n", httpCode);
         Serial_printf("[NETWORK_MONITOR] Response: %s\n", response.c_str());
+        if (validators) validators->clear();
         return 0;
       }
     } else {
@@ -305,8 +772,8 @@ uint16_t NetworkMonitor::performSafeHealthCheck(const String& url, const String&
     }
   } else {
     // Check error category for better logging
-    ErrorCategory errorCategory = httpClient->getLastErrorCategory();
-    int httpCode = httpClient->getLastHttpCode();
+    ErrorCategory errorCategory = client.getLastErrorCategory();
+    int httpCode = client.getLastHttpCode();
     
     switch (errorCategory) {
       case ErrorCategory::SSL_ERROR:
@@ -324,7 +791,7 @@ uint16_t NetworkMonitor::performSafeHealthCheck(const String& url, const String&
     }
     
     // Log response details for debugging
-    String response = httpClient->getLastResponse();
+    String response = client.getLastResponse();
     if (response.length() > 0) {
       Serial_printf("[NETWORK_MONITOR] Response: %s\n", response.c_str());
     }
@@ -337,10 +804,11 @@ void NetworkMonitor::notifyDisplayUpdate(int index, Status status, uint16_t late
   Serial_printf("[NETWORK_MONITOR] notifyDisplayUpdate: index=%d, status=%d, latency=%d\n", 
                index, status, latency);
   
-  if (displayManager) {
-    displayManager->updateTargetStatus(index, status, latency);
-  } else {
-    Serial_println("[NETWORK_MONITOR] ERROR: displayManager is null!");
+  // Queued for the display task; a newer result for the same target replaces
+  // one the display hasn't drawn yet
+  ScanEvent event = {EV_TARGET_UPDATE, index, status, latency};
+  if (!TaskManager::sendEvent(event)) {
+    Serial_println("[NETWORK_MONITOR] ERROR: Display event dropped!");
   }
 }
 
@@ -351,34 +819,438 @@ MonitorType NetworkMonitor::parseMonitorType(const String& type) const {
   return PING;
 }
 
+AlertPolicy NetworkMonitor::loadAlertPolicy(int index) const {
+  // Global defaults from config.env, each value checked on its own so a bad one keeps the built-in default
+  AlertPolicy policy;
+  long value = ConfigLoader::getMaxFailuresBeforeAlert();
+  if (policyInRange(-1, "MAX_FAILURES_BEFORE_ALERT", value, 1, 255)) policy.consecutiveFailures = value;
+  value = ConfigLoader::getAlertCooldownMs();
+  if (policyInRange(-1, "ALERT_COOLDOWN_MS", value, 0, MAX_POLICY_COOLDOWN_MS)) policy.alertCooldownMs = value;
+  value = ConfigLoader::getAlertRecoveryCooldownMs();
+  if (policyInRange(-1, "ALERT_RECOVERY_COOLDOWN_MS", value, 0, MAX_POLICY_COOLDOWN_MS)) policy.recoveryCooldownMs = value;
+  
+  long first = ConfigLoader::getAlertWindowFailures();
+  long second = ConfigLoader::getAlertWindowSize();
+  if (policyInRange(-1, "ALERT_WINDOW_SIZE", second, 0, AlertPolicy::MAX_WINDOW_SIZE) &&
+      policyInRange(-1, "ALERT_WINDOW_FAILURES", first, 0, second)) {
+    policy.windowFailures = first;
+    policy.windowSize = second;
+  }
+  first = ConfigLoader::getFlapHighThreshold();
+  second = ConfigLoader::getFlapLowThreshold();
+  if (policyInRange(-1, "FLAP_HIGH_THRESHOLD", first, 0, 100) &&
+      policyInRange(-1, "FLAP_LOW_THRESHOLD", second, 0, first)) {
+    policy.flapHighPercent = first;
+    policy.flapLowPercent = second;
+  }
+  
+  // Per-target overrides: ...|TYPE|fail=5|window=6/10|cooldown=600000|recovery_cooldown=30000|flap=50/25
+  // A bad override is logged and the global value stays
+  if (index >= 0) {
+    if (readPolicyOption(index, "fail", value) && policyInRange(index, "fail", value, 1, 255)) {
+      policy.consecutiveFailures = value;
+    }
+    if (readPolicyOption(index, "cooldown", value) && policyInRange(index, "cooldown", value, 0, MAX_POLICY_COOLDOWN_MS)) {
+      policy.alertCooldownMs = value;
+    }
+    if (readPolicyOption(index, "recovery_cooldown", value) &&
+        policyInRange(index, "recovery_cooldown", value, 0, MAX_POLICY_COOLDOWN_MS)) {
+      policy.recoveryCooldownMs = value;
+    }
+    
+    if (readPolicyPair(index, "flap", first, second) && policyInRange(index, "flap high", first, 0, 100) &&
+        policyInRange(index, "flap low", second, 0, first)) {
+      policy.flapHighPercent = first;
+      policy.flapLowPercent = second;
+    }
+    
+    if (readPolicyPair(index, "window", first, second) &&
+        policyInRange(index, "window size", second, 0, AlertPolicy::MAX_WINDOW_SIZE) &&
+        policyInRange(index, "window failures", first, 0, second)) {
+      policy.windowFailures = first;
+      policy.windowSize = second;
+    }
+  }
+  
+  policy.normalize();
+  
+  if (index >= 0) {
+    Serial_printf("[NETWORK_MONITOR] Target %d alert policy: %u consecutive, %u/%u window, cooldown %lums/%lums, flap %u%%/%u%%\n",
+                 index + 1, policy.consecutiveFailures, policy.windowFailures, policy.windowSize,
+                 (unsigned long)policy.alertCooldownMs, (unsigned long)policy.recoveryCooldownMs,
+                 policy.flapHighPercent, policy.flapLowPercent);
+  }
+  
+  return policy;
+}
+
+void NetworkMonitor::loadLatencySlo(int index) {
+  // Global default, overridable per target: ...|TYPE|slo_p95=800|slo_sustain=300000
+  String sloMs = ConfigLoader::getTargetOption(index, "slo_p95", String(ConfigLoader::getLatencySloP95Ms()));
+  String sustainMs = ConfigLoader::getTargetOption(index, "slo_sustain", String(ConfigLoader::getLatencySloSustainMs()));
+  
+  long slo = sloMs.toInt();
+  latencySlo[index].configure(slo > 0 && slo <= 60000 ? slo : 0, sustainMs.toInt());
+  
+  if (latencySlo[index].isEnabled()) {
+    Serial_printf("[NETWORK_MONITOR] Target %d latency SLO: p95 <= %ums, sustained %lums\n",
+                 index + 1, latencySlo[index].getSloMs(), (unsigned long)sustainMs.toInt());
+  }
+}
+
+void NetworkMonitor::resolveDependencies() {
+  // Resolve parent=<name> options to indices
+  for (int i = 0; i < targetCount; i++) {
+    targets[i].setParentIndex(-1);
+    String parentName = ConfigLoader::getTargetOption(i, "parent");
+    if (parentName.length() == 0) continue;
+    
+    for (int j = 0; j < targetCount; j++) {
+      if (j != i && targets[j].getName().equalsIgnoreCase(parentName)) {
+        targets[i].setParentIndex(j);
+        break;
+      }
+    }
+    
+    if (!targets[i].hasParent()) {
+      Serial_printf("[NETWORK_MONITOR] WARNING: Parent '%s' of %s not found, ignoring\n",
+                   parentName.c_str(), targets[i].getName().c_str());
+    }
+  }
+  
+  // Break cycles: a target whose parent chain leads back to itself drops its parent
+  for (int i = 0; i < targetCount; i++) {
+    int current = targets[i].getParentIndex();
+    for (int steps = 0; current >= 0 && steps < targetCount; steps++) {
+      if (current == i) {
+        Serial_printf("[NETWORK_MONITOR] WARNING: Dependency cycle at %s, dropping its parent\n",
+                     targets[i].getName().c_str());
+        targets[i].setParentIndex(-1);
+        break;
+      }
+      current = targets[current].getParentIndex();
+    }
+  }
+  
+  // Depth of each target in the (now acyclic) dependency forest
+  int8_t depth[10];
+  for (int i = 0; i < targetCount; i++) {
+    depth[i] = 0;
+    for (int current = targets[i].getParentIndex(); current >= 0; current = targets[current].getParentIndex()) {
+      depth[i]++;
+    }
+  }
+  
+  // Scan order: stable by depth so every parent is probed before its children
+  int n = 0;
+  for (int level = 0; level < targetCount && n < targetCount; level++) {
+    for (int i = 0; i < targetCount; i++) {
+      if (depth[i] == level) {
+        scanOrder[n++] = i;
+      }
+    }
+  }
+  
+  for (int i = 0; i < targetCount; i++) {
+    if (targets[i].hasParent()) {
+      Serial_printf("[NETWORK_MONITOR] Target %d (%s) depends on %s\n", i + 1,
+                   targets[i].getName().c_str(), targets[targets[i].getParentIndex()].getName().c_str());
+    }
+  }
+}
+
+void NetworkMonitor::recordSla(int index, Status status, uint16_t latency) {
+  // Only probed results count: unreachable children are the parent's outage
+  if (status != UP && status != DOWN) return;
+  
+  slaTrackers[index].record(NTPService::getEpochTime(), status == UP, latency);
+}
+
+void NetworkMonitor::loadMaintenance(int index) {
+  // Cron-like windows: ...|TYPE|maint=0 3 * 60;30 22 6 240
+  String spec = ConfigLoader::getTargetOption(index, "maint");
+  if (!maintenance[index].parse(spec)) {
+    Serial_printf("[NETWORK_MONITOR] WARNING: Invalid maintenance window '%s' for target %d, ignoring\n",
+                 spec.c_str(), index + 1);
+  } else if (maintenance[index].hasWindows()) {
+    Serial_printf("[NETWORK_MONITOR] Target %d maintenance: %u window(s)\n", index + 1,
+                 maintenance[index].getWindowCount());
+  }
+}
+
+bool NetworkMonitor::isMaintenanceProbeDue(int index) {
+  MaintenanceSchedule& schedule = maintenance[index];
+  if (!schedule.hasWindows()) return true;
+  
+  bool wasInWindow = schedule.isInWindow();
+  bool inWindow = schedule.isActive(NTPService::getEpochTime());
+  
+  if (inWindow != wasInWindow) {
+    Serial_printf("[NETWORK_MONITOR] %s %s maintenance window\n", targets[index].getName().c_str(),
+                 inWindow ? "entered" : "left");
+    updateSnapshot(index);
+  }
+  
+  if (!inWindow || lastProbeTime[index] == 0) return true;
+  return millis() - lastProbeTime[index] >= maintenanceProbeInterval;
+}
+
+HttpValidators* NetworkMonitor::getValidators(int index) {
+  return conditionalGet[index] ? &validators[index] : nullptr;
+}
+
+uint32_t NetworkMonitor::hashTargetName(int index) const {
+  // FNV-1a, detects targets renamed or reordered between checkpoints
+  uint32_t hash = 2166136261u;
+  // getName() returns a copy, keep it alive while hashing
+  String nameCopy = targets[index].getName();
+  const char* name = nameCopy.c_str();
+  while (*name) {
+    hash ^= (uint8_t)*name++;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool NetworkMonitor::saveSlaCheckpoint() {
+  // Trackers are only meaningful once aligned to wall-clock time
+  if (!NTPService::isTimeSynced()) return false;
+  
+  unsigned long startTime = millis();
+  
+  // Write to a temporary file so a reset mid-write keeps the previous checkpoint
+  File file = SPIFFS.open(SLA_CHECKPOINT_TEMP_PATH, FILE_WRITE);
+  if (!file) {
+    Serial_println("[NETWORK_MONITOR] ERROR: Failed to open SLA checkpoint for writing");
+    return false;
+  }
+  
+  SlaCheckpointHeader header = { SLA_CHECKPOINT_MAGIC, sizeof(SlaCheckpointRecord), (uint8_t)targetCount, 0 };
+  bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+  
+  for (int i = 0; i < targetCount && ok; i++) {
+    SlaCheckpointRecord record;
+    record.nameHash = hashTargetName(i);
+    record.tracker = slaTrackers[i];
+    ok = file.write((const uint8_t*)&record, sizeof(record)) == sizeof(record);
+  }
+  file.close();
+  
+  if (!ok) {
+    Serial_println("[NETWORK_MONITOR] ERROR: SLA checkpoint write failed");
+    SPIFFS.remove(SLA_CHECKPOINT_TEMP_PATH);
+    return false;
+  }
+  
+  SPIFFS.remove(SLA_CHECKPOINT_PATH);
+  SPIFFS.rename(SLA_CHECKPOINT_TEMP_PATH, SLA_CHECKPOINT_PATH);
+  
+  Serial_printf("[NETWORK_MONITOR] SLA checkpoint saved (%d targets, %u bytes, %lums)\n", targetCount,
+               (unsigned)(sizeof(header) + targetCount * sizeof(SlaCheckpointRecord)), millis() - startTime);
+  return true;
+}
+
+bool NetworkMonitor::restoreSlaCheckpoint() {
+  if (!SPIFFS.exists(SLA_CHECKPOINT_PATH)) return false;
+  
+  File file = SPIFFS.open(SLA_CHECKPOINT_PATH, FILE_READ);
+  if (!file) return false;
+  
+  SlaCheckpointHeader header;
+  if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+      header.magic != SLA_CHECKPOINT_MAGIC || header.recordSize != sizeof(SlaCheckpointRecord)) {
+    Serial_println("[NETWORK_MONITOR] WARNING: Ignoring incompatible SLA checkpoint");
+    file.close();
+    return false;
+  }
+  
+  // Restore by position, only where the target at that index kept its name
+  int restored = 0;
+  for (int i = 0; i < header.targetCount && i < targetCount; i++) {
+    SlaCheckpointRecord record;
+    if (file.read((uint8_t*)&record, sizeof(record)) != sizeof(record)) break;
+    
+    if (record.nameHash == hashTargetName(i)) {
+      slaTrackers[i] = record.tracker;
+      restored++;
+    }
+  }
+  file.close();
+  
+  Serial_printf("[NETWORK_MONITOR] Restored SLA history for %d/%d targets\n", restored, targetCount);
+  return restored > 0;
+}
+
+void NetworkMonitor::resolveProbeGroups() {
+  // Targets with the same probe (type, URL, endpoint) and parent are probed
+  // once per cycle by the first of them; the result fans out to the rest
+  for (int i = 0; i < targetCount; i++) {
+    probeLeader[i] = i;
+    for (int j = 0; j < i; j++) {
+      if (probeLeader[j] == j && hasSameProbe(i, j)) {
+        probeLeader[i] = j;
+        Serial_printf("[NETWORK_MONITOR] Target %d (%s) shares the probe of target %d (%s)\n",
+                     i + 1, targets[i].getName().c_str(), j + 1, targets[j].getName().c_str());
+        break;
+      }
+    }
+  }
+}
+
+bool NetworkMonitor::hasSameProbe(int a, int b) const {
+  const Target& first = targets[a];
+  const Target& second = targets[b];
+  
+  if (first.getMonitorType() != second.getMonitorType() ||
+      first.getParentIndex() != second.getParentIndex() ||
+      first.getUrl() != second.getUrl()) {
+    return false;
+  }
+  
+  // PING ignores the endpoint
+  return first.getMonitorType() == PING || first.getHealthEndpoint() == second.getHealthEndpoint();
+}
+
+bool NetworkMonitor::isGroupProbeDue(int leader) {
+  // Evaluate every member so maintenance transitions are logged for all of them
+  bool due = isMaintenanceProbeDue(leader);
+  for (int i = 0; i < targetCount; i++) {
+    if (i != leader && probeLeader[i] == leader) {
+      due = isMaintenanceProbeDue(i) || due;
+    }
+  }
+  return due;
+}
+
+void NetworkMonitor::fanOutResult(int leader) {
+  for (int i = 0; i < targetCount; i++) {
+    if (i == leader || probeLeader[i] != leader) continue;
+    
+    updateTargetStatus(i, targets[leader].getStatus(), targets[leader].getLatency());
+    lastProbeTime[i] = lastProbeTime[leader];
+    coalescedResults++;
+  }
+}
+
+bool NetworkMonitor::isParentDown(int index) const {
+  int parent = targets[index].getParentIndex();
+  if (parent < 0) return false;
+  
+  Status parentStatus = targets[parent].getStatus();
+  return parentStatus == DOWN || parentStatus == UNREACHABLE;
+}
+
+int NetworkMonitor::countUnreachableDependents(int index) const {
+  int count = 0;
+  for (int i = 0; i < targetCount; i++) {
+    if (!targets[i].isUnreachable()) continue;
+    
+    for (int current = targets[i].getParentIndex(); current >= 0; current = targets[current].getParentIndex()) {
+      if (current == index) {
+        count++;
+        break;
+      }
+    }
+  }
+  return count;
+}
+
 void NetworkMonitor::printPerformanceMetrics() const {
   Serial_println("\n=== NETWORK MONITOR PERFORMANCE ===");
   Serial_printf("Targets: %d\n", targetCount);
   Serial_printf("Scanning: %s\n", scanning ? "YES" : "NO");
   Serial_printf("Scan Interval: %lu ms\n", scanInterval);
   Serial_printf("Last Scan: %lu ms ago\n", millis() - lastScanTime);
+  Serial_printf("Probe Spacing: %lu ms\n", getProbeOffset(1));
+  Serial_printf("Scans Aborted: %lu\n", (unsigned long)scansAborted);
+  Serial_printf("Coalesced Results: %lu (probes saved)\n", (unsigned long)coalescedResults);
+  Serial_printf("Skipped Probes: %lu (no TLS slot or socket, requeued)\n", (unsigned long)skippedProbes);
+  Serial_printf("Probes In Flight: %d\n", __builtin_popcount(inFlightTargets));
+  Serial_printf("Staleness Bound: %lu ms (%d target(s) beyond it after last cycle)\n", stalenessBound, starvedTargets);
+  if (minProbeFreeHeap != UINT32_MAX) {
+    Serial_printf("Min Free Heap After Probe: %lu bytes\n", (unsigned long)minProbeFreeHeap);
+  }
   
+  Serial_println("\n--- Availability (1h / 24h / 7d) ---");
+  for (int i = 0; i < targetCount; i++) {
+    const SlaTracker& sla = slaTrackers[i];
+    uint16_t hour = sla.getAvailabilityPermille(SLA_1H);
+    uint16_t day = sla.getAvailabilityPermille(SLA_24H);
+    uint16_t week = sla.getAvailabilityPermille(SLA_7D);
+    Serial_printf("%-16s %3u.%u%% / %3u.%u%% / %3u.%u%%  mean %ums\n", targets[i].getName().c_str(),
+                 hour / 10, hour % 10, day / 10, day % 10, week / 10, week % 10, sla.getMeanLatency(SLA_24H));
+  }
+  
+  Serial_println("\n--- Scheduling (expected cost / result age / starved) ---");
+  unsigned long now = millis();
+  for (int i = 0; i < targetCount; i++) {
+    Serial_printf("%-16s %5ums  %6lums  %u\n", targets[i].getName().c_str(), expectedCost[i],
+                 lastResultTime[i] > 0 ? now - lastResultTime[i] : 0UL, starvationCount[i]);
+  }
+  
+  Serial_printf("\n--- Latency History (last %u samples) ---\n", HISTORY_DEPTH);
+  for (int i = 0; i < targetCount; i++) {
+    // The scanner may be appending, decode a copy
+    uint16_t records[HISTORY_DEPTH];
+    LatencyHistory::Cursor cursor = history[i].snapshot(records, HISTORY_DEPTH);
+    LatencySample sample;
+    uint16_t minLatency = 0xFFFF, maxLatency = 0, upCount = 0;
+    uint32_t total = 0;
+    while (cursor.next(sample)) {
+      if (sample.status != UP) continue;
+      upCount++;
+      total += sample.latency;
+      if (sample.latency < minLatency) minLatency = sample.latency;
+      if (sample.latency > maxLatency) maxLatency = sample.latency;
+    }
+    if (upCount == 0) {
+      Serial_printf("%-16s %u samples, none UP\n", targets[i].getName().c_str(), cursor.getCount());
+    } else {
+      Serial_printf("%-16s %u samples, %u UP, min/avg/max %u/%lu/%u ms\n", targets[i].getName().c_str(),
+                   cursor.getCount(), upCount, minLatency, (unsigned long)(total / upCount), maxLatency);
+    }
+  }
+  
+  ProbeWorkerPool::printStatistics();
+  AsyncProbePool::printStatistics();
+  
+  Serial_println("\n--- DNS Cache ---");
+  DnsCache::printStatistics();
+  
+  // Scanner and worker clients each count their own requests
+  HttpClient::Metrics http = {};
+  http.lastErrorCategory = ErrorCategory::UNKNOWN;
   if (httpClient) {
-    Serial_println("\n--- HTTP Client Metrics ---");
-    httpClient->printMetrics();
+    httpClient->accumulateMetrics(http);
   }
+  ProbeWorkerPool::accumulateClientMetrics(http);
+  Serial_printf("\n--- HTTP Client Metrics (scanner + %u worker(s)) ---\n", ProbeWorkerPool::getWorkerCount());
+  HttpClient::printMetrics(http);
   
   Serial_println("===============================\n");
 }
 
 void NetworkMonitor::resetPerformanceMetrics() {
+  scansAborted = 0;
+  coalescedResults = 0;
+  skippedProbes = 0;
+  minProbeFreeHeap = UINT32_MAX;
+  for (int i = 0; i < targetCount; i++) {
+    starvationCount[i] = 0;
+  }
   if (httpClient) {
     httpClient->resetMetrics();
   }
+  ProbeWorkerPool::resetClientMetrics();
   Serial_println("[NETWORK_MONITOR] Performance metrics reset");
 }
 
 bool NetworkMonitor::isScanStuck() const {
   if (!scanning) return false;
   
-  // If scan has been running for more than 60 seconds, consider it stuck
+  // A staggered cycle spans the interval; stuck if it runs a minute past it
   unsigned long scanDuration = millis() - scanStartTime;
-  return scanDuration > 60000;
+  return scanDuration > scanInterval + 60000;
 }
 
 void NetworkMonitor::forceStopScan() {
@@ -388,7 +1260,6 @@ void NetworkMonitor::forceStopScan() {
   scanning = false;
   
   // Notify display that scan was force-stopped
-  if (displayManager) {
-    displayManager->onScanCompleted();
-  }
+  ScanEvent event = {EV_SCAN_COMPLETE, -1, UNKNOWN, 0};
+  TaskManager::sendEvent(event);
 }
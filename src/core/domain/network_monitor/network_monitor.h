@@ -1,30 +1,69 @@
 #pragma once
 #include "core/domain/target/target.h"
 #include "core/domain/alert/alert.h"
+#include "core/domain/status_snapshot/status_snapshot.h"
+#include "core/domain/latency_slo/latency_slo.h"
+#include "core/domain/sla_tracker/sla_tracker.h"
+#include "core/domain/latency_history/latency_history.h"
+#include "core/domain/maintenance_window/maintenance_window.h"
+#include "core/infrastructure/notifier/notifier.h"
+#include "core/infrastructure/dns_cache/dns_cache.h"
 #include "core/infrastructure/wifi_service/wifi_service.h"
 #include "core/infrastructure/http_client/http_client.h"
-#include "core/infrastructure/telegram_service/telegram_service.h"
+#include "core/infrastructure/probe_worker_pool/probe_worker_pool.h"
 #include "ui/display_manager/display_manager.h"
 #include "core/infrastructure/task_manager/task_manager.h"
 #include <Arduino.h>
 
 class NetworkMonitor {
+public:
+  static const uint16_t HISTORY_DEPTH = 120;   // samples kept per target
+  
 private:
   // Dependencies
   WiFiService* wifiService;
   HttpClient* httpClient;
-  TelegramService* telegramService;
   DisplayManager* displayManager;
   TaskManager* taskManager;
   
   // State
   Target targets[10];
+  int8_t scanOrder[10];    // Parents before children
+  int8_t probeLeader[10];  // Target that probes on this one's behalf (itself if not coalesced)
+  Alert alerts[10];
+  LatencySlo latencySlo[10];
+  SlaTracker slaTrackers[10];
+  LatencyHistory history[10];
+  uint16_t historyArena[10 * HISTORY_DEPTH];   // backing store for all history rings
+  MaintenanceSchedule maintenance[10];
+  HttpValidators validators[10];               // ETag/Last-Modified of the last healthy body
+  bool conditionalGet[10];
+  unsigned long lastProbeTime[10];             // millis() of the last real probe, 0 = never
+  unsigned long lastResultTime[10];            // millis() of the last result of any kind, 0 = never
+  uint16_t expectedCost[10];                   // smoothed probe duration (ms)
+  uint16_t starvationCount[10];                // probes that found the result past the staleness bound
+  StatusSnapshot snapshot; // Working copy, published after every change
+  bool snapshotPending;    // last publish was declined, retried from update()
   int targetCount;
   bool scanning;
   unsigned long lastScanTime;
   unsigned long scanInterval;
   unsigned long scanStartTime;
   unsigned long lastScanDuration;
+  int nextScanSlot;            // probes dispatched so far this cycle
+  uint16_t pendingTargets;     // bitmask of targets not yet decided this cycle
+  uint16_t inFlightTargets;    // bitmask of probes running on a worker
+  bool dispatchClosed;         // out of time or memory, only waiting for in-flight probes
+  uint32_t scansAborted;
+  uint32_t coalescedResults;   // results fanned out instead of probed
+  uint32_t skippedProbes;      // requeued for lack of a TLS slot, never counted as failures
+  uint32_t minProbeFreeHeap;   // lowest free heap seen right after a probe
+  unsigned long stalenessBound;
+  int starvedTargets;          // targets past the bound at the end of the last cycle
+  DnsCache::Stats cycleDnsStart;  // DNS counters at cycle start, for per-cycle deltas
+  unsigned long slaCheckpointInterval;
+  unsigned long lastSlaCheckpoint;
+  unsigned long maintenanceProbeInterval;
   
   // Configuration
   bool initialized;
@@ -35,8 +74,7 @@ public:
   
   // Initialization
   bool initialize();
-  void setDependencies(WiFiService* wifi, HttpClient* http, TelegramService* telegram, 
-                      DisplayManager* display, TaskManager* tasks);
+  void setDependencies(WiFiService* wifi, HttpClient* http, DisplayManager* display, TaskManager* tasks);
   
   // Main operations
   void update();
@@ -47,10 +85,13 @@ public:
   bool loadTargets();
   void scanTarget(int index);
   void updateTargetStatus(int index, Status status, uint16_t latency);
-  uint16_t performSafeHealthCheck(const String& url, const String& endpoint, uint16_t timeout = 10000);
+  uint16_t performSafeHealthCheck(const String& url, const String& endpoint, uint16_t timeout = 10000,
+                                  HttpValidators* validators = nullptr);
   
   // Getters
   int getTargetCount() const { return targetCount; }
+  const SlaTracker& getSlaTracker(int index) const { return slaTrackers[index]; }
+  const LatencyHistory& getLatencyHistory(int index) const { return history[index]; }
   Target* getTargets() { return targets; }
   bool isScanning() const { return scanning; }
   bool isInitialized() const { return initialized; }
@@ -63,14 +104,50 @@ public:
   void printPerformanceMetrics() const;
   void resetPerformanceMetrics();
   
+  // SLA history persistence
+  bool saveSlaCheckpoint();
+  bool restoreSlaCheckpoint();
+  
   // Scan monitoring
   bool isScanStuck() const;
   void forceStopScan();
   unsigned long getLastScanDuration() const { return lastScanDuration; }
+  int getStarvedTargetCount() const { return starvedTargets; }
   
 private:
   // Internal methods
-  void processScanResults();
+  void dispatchDueProbe();
+  void collectProbeResults();
+  void collectDeliveryReceipts();
+  static uint16_t runProbeOnWorker(void* context, int index, HttpClient& client);
+  uint16_t runProbe(int index, HttpClient& client);
+  uint16_t runHealthCheck(HttpClient& client, const String& url, const String& endpoint, HttpValidators* validators);
+  void applyProbeResult(int index, uint16_t latency, unsigned long durationMs);
+  void requeueProbe(int index);
+  int selectNextTarget(unsigned long elapsed);
+  long getStalenessSlack(int index, unsigned long now) const;
+  void finishScan();
+  unsigned long getProbeOffset(int slot) const;
   void notifyDisplayUpdate(int index, Status status, uint16_t latency);
+  void evaluateAlert(int index, Status status, uint16_t latency);
+  void resetSnapshot();
+  void updateSnapshot(int index);
+  void publishSnapshot();
+  NotificationEvent createEvent(int index, NotificationType type, Status status, uint16_t latency) const;
+  bool raiseNotification(const NotificationEvent& event);
   MonitorType parseMonitorType(const String& type) const;
+  AlertPolicy loadAlertPolicy(int index) const;
+  void loadLatencySlo(int index);
+  void recordSla(int index, Status status, uint16_t latency);
+  void loadMaintenance(int index);
+  bool isMaintenanceProbeDue(int index);
+  uint32_t hashTargetName(int index) const;
+  HttpValidators* getValidators(int index);
+  void resolveDependencies();
+  void resolveProbeGroups();
+  bool hasSameProbe(int a, int b) const;
+  bool isGroupProbeDue(int leader);
+  void fanOutResult(int leader);
+  bool isParentDown(int index) const;
+  int countUnreachableDependents(int index) const;
 };
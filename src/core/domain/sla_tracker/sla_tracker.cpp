@@ -0,0 +1,106 @@
+#include "core/domain/sla_tracker/sla_tracker.h"
+
+const uint8_t SlaTracker::TIER_SIZES[TIER_COUNT] = { 12, 24, 7 };
+const uint32_t SlaTracker::TIER_BUCKET_SECONDS[TIER_COUNT] = { 300, 3600, 86400 };
+
+SlaTracker::SlaTracker() {
+  clear();
+}
+
+void SlaTracker::clear() {
+  memset(minutes, 0, sizeof(minutes));
+  memset(hours, 0, sizeof(hours));
+  memset(days, 0, sizeof(days));
+  memset(tiers, 0, sizeof(tiers));
+}
+
+SlaTracker::Bucket* SlaTracker::tierBuckets(uint8_t tier) {
+  switch (tier) {
+    case 0: return minutes;
+    case 1: return hours;
+    default: return days;
+  }
+}
+
+void SlaTracker::advance(uint8_t tier, uint32_t nowSeconds) {
+  Tier& t = tiers[tier];
+  uint32_t bucketId = nowSeconds / TIER_BUCKET_SECONDS[tier];
+  
+  // First wall-clock timestamp: adopt it, keep what was recorded so far
+  if (t.bucketId == 0) {
+    t.bucketId = bucketId;
+    return;
+  }
+  
+  if (bucketId <= t.bucketId) return;
+  
+  // Rotate, evicting at most one full ring however long the gap was
+  Bucket* buckets = tierBuckets(tier);
+  uint32_t steps = bucketId - t.bucketId;
+  if (steps > TIER_SIZES[tier]) steps = TIER_SIZES[tier];
+  
+  for (uint32_t i = 0; i < steps; i++) {
+    t.head = (t.head + 1) % TIER_SIZES[tier];
+    Bucket& b = buckets[t.head];
+    t.okSum -= b.ok;
+    t.failedSum -= b.failed;
+    t.latencySum -= (uint32_t)b.meanLatency * b.ok;
+    memset(&b, 0, sizeof(b));
+  }
+  
+  t.bucketId = bucketId;
+}
+
+void SlaTracker::addSample(uint8_t tier, bool up, uint16_t latency) {
+  Tier& t = tiers[tier];
+  Bucket& b = tierBuckets(tier)[t.head];
+  
+  if (!up) {
+    if (b.failed < 0xFFFF) {
+      b.failed++;
+      t.failedSum++;
+    }
+    return;
+  }
+  
+  if (b.ok == 0xFFFF) return;
+  
+  // Keep latencySum consistent with the stored (rounded) bucket mean
+  uint32_t before = (uint32_t)b.meanLatency * b.ok;
+  // Round to nearest so repeated updates don't drift downwards
+  uint32_t count = b.ok + 1;
+  b.meanLatency = (uint16_t)((before + latency + count / 2) / count);
+  b.ok++;
+  t.okSum++;
+  t.latencySum = t.latencySum - before + (uint32_t)b.meanLatency * b.ok;
+}
+
+void SlaTracker::record(uint32_t nowSeconds, bool up, uint16_t latency) {
+  for (uint8_t tier = 0; tier < TIER_COUNT; tier++) {
+    if (nowSeconds > 0) {
+      advance(tier, nowSeconds);
+    }
+    addSample(tier, up, latency);
+  }
+}
+
+bool SlaTracker::hasData(SlaWindow window) const {
+  return getCheckCount(window) > 0;
+}
+
+uint32_t SlaTracker::getCheckCount(SlaWindow window) const {
+  const Tier& t = tiers[window];
+  return t.okSum + t.failedSum;
+}
+
+uint16_t SlaTracker::getAvailabilityPermille(SlaWindow window) const {
+  const Tier& t = tiers[window];
+  uint32_t total = t.okSum + t.failedSum;
+  if (total == 0) return 0;
+  return (uint16_t)((uint64_t)t.okSum * 1000 / total);
+}
+
+uint16_t SlaTracker::getMeanLatency(SlaWindow window) const {
+  const Tier& t = tiers[window];
+  return t.okSum > 0 ? (uint16_t)(t.latencySum / t.okSum) : 0;
+}
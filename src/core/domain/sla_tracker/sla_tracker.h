@@ -0,0 +1,68 @@
+#pragma once
+#include <Arduino.h>
+
+// Rolling availability windows
+enum SlaWindow : uint8_t {
+  SLA_1H = 0,
+  SLA_24H = 1,
+  SLA_7D = 2
+};
+
+static const uint8_t SLA_WINDOW_COUNT = 3;
+static const uint16_t SLA_NO_DATA = 0xFFFF;
+
+/**
+ * @brief Rolling uptime/SLA accounting for one target
+ * 
+ * Three bucket rings (12 x 5 min, 24 x 1 h, 7 x 1 day) each keep running
+ * totals of their buckets, so recording a result and querying a window are
+ * constant time. Buckets are aligned to wall-clock time so the state can be
+ * checkpointed to flash and resumed after a reboot. The class is plain data
+ * (no pointers) and is persisted as raw bytes.
+ */
+class SlaTracker {
+public:
+  static const uint8_t TIER_COUNT = 3;
+  
+private:
+  struct Bucket {
+    uint16_t ok;
+    uint16_t failed;
+    uint16_t meanLatency;  // mean of successful checks in this bucket
+  };
+  
+  struct Tier {
+    uint32_t bucketId;     // wall-clock seconds / bucket length of the head bucket
+    uint32_t okSum;
+    uint32_t failedSum;
+    uint32_t latencySum;   // sum of meanLatency * ok over the ring
+    uint8_t head;
+  };
+  
+  static const uint8_t TIER_SIZES[TIER_COUNT];
+  static const uint32_t TIER_BUCKET_SECONDS[TIER_COUNT];
+  
+  Bucket minutes[12];
+  Bucket hours[24];
+  Bucket days[7];
+  Tier tiers[TIER_COUNT];
+  
+public:
+  SlaTracker();
+  void clear();
+  
+  // Record one check result. nowSeconds = wall-clock seconds, 0 if unknown
+  // (the result then goes into the current buckets without rotating them).
+  void record(uint32_t nowSeconds, bool up, uint16_t latency);
+  
+  // Queries, O(1)
+  bool hasData(SlaWindow window) const;
+  uint16_t getAvailabilityPermille(SlaWindow window) const;  // 1000 = 100%
+  uint16_t getMeanLatency(SlaWindow window) const;
+  uint32_t getCheckCount(SlaWindow window) const;
+  
+private:
+  Bucket* tierBuckets(uint8_t tier);
+  void advance(uint8_t tier, uint32_t nowSeconds);
+  void addSample(uint8_t tier, bool up, uint16_t latency);
+};
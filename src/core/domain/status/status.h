@@ -1,13 +1,26 @@
 #pragma once
 #include <Arduino.h>
 
+// Most targets the monitor loads (TARGET_1 .. TARGET_10)
+static const uint8_t MAX_TARGETS = 10;
+
 // Status enumeration for network targets
 enum Status : uint8_t { 
   UNKNOWN = 0, 
   UP = 1, 
-  DOWN = 2 
+  DOWN = 2,
+  UNREACHABLE = 3  // Not probed because a parent target is down
 };
 
+inline const char* getStatusName(Status status) {
+  switch (status) {
+    case UP: return "UP";
+    case DOWN: return "DOWN";
+    case UNREACHABLE: return "UNREACHABLE";
+    default: return "UNKNOWN";
+  }
+}
+
 // Monitor type enumeration
 enum MonitorType : uint8_t { 
   PING = 0, 
@@ -0,0 +1,41 @@
+#include "core/domain/status_snapshot/status_snapshot.h"
+
+// Static member definitions
+StatusSnapshot StatusSnapshotStore::buffers[2] = {};
+std::atomic<uint32_t> StatusSnapshotStore::sequence(0);
+std::atomic<uint8_t> StatusSnapshotStore::readers[2] = {{0}, {0}};
+uint32_t StatusSnapshotStore::deferred = 0;
+
+bool StatusSnapshotStore::publish(StatusSnapshot& snapshot) {
+  // Only the writer moves the sequence, so the back buffer can't change under us
+  uint32_t current = sequence.load();
+  uint8_t back = (current + 1) & 1;
+  if (readers[back].load() != 0) {
+    deferred++;
+    return false;
+  }
+  
+  snapshot.publishedAt = millis();
+  snapshot.sequence = current + 1;
+  buffers[back] = snapshot;
+  sequence.store(current + 1);
+  return true;
+}
+
+const StatusSnapshot* StatusSnapshotStore::acquire() {
+  while (true) {
+    uint32_t current = sequence.load();
+    uint8_t front = current & 1;
+    readers[front].fetch_add(1);
+    // Unchanged sequence: the pin landed before the writer could pick this buffer
+    if (sequence.load() == current) {
+      return &buffers[front];
+    }
+    readers[front].fetch_sub(1);
+  }
+}
+
+void StatusSnapshotStore::release(const StatusSnapshot* snapshot) {
+  if (!snapshot) return;
+  readers[snapshot == &buffers[0] ? 0 : 1].fetch_sub(1);
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "core/domain/status/status.h"
+#include "core/domain/sla_tracker/sla_tracker.h"
+#include "freertos/FreeRTOS.h"
+#include <Arduino.h>
+#include <atomic>
+
+// Point-in-time view of one target, as last evaluated by the scanner
+struct TargetSnapshot {
+  char name[32];
+  Status status;
+  uint16_t latency;
+  uint8_t failureCount;
+  bool healthCheck;        // HEALTH_CHECK target, latency reads as "OK"/"FAIL"
+  bool alertActive;
+  bool flapping;
+  bool latencyDegraded;
+  bool maintenance;        // inside a planned maintenance window
+  uint16_t p95Latency;     // rolling p95 (0 = SLO tracking disabled)
+  uint32_t lastCheckAt;    // millis() of the last result
+  uint32_t lastChangeAt;   // millis() of the last status change
+  uint16_t availability[SLA_WINDOW_COUNT];  // permille per SlaWindow, SLA_NO_DATA if no checks
+  uint16_t meanLatency[SLA_WINDOW_COUNT];   // ms per SlaWindow
+};
+
+// Point-in-time view of the whole monitor
+struct StatusSnapshot {
+  uint32_t sequence;       // incremented on every publish
+  uint32_t publishedAt;    // millis() of the publish
+  uint32_t lastScanDuration;
+  uint8_t targetCount;
+  TargetSnapshot targets[10];
+};
+
+/**
+ * @brief Status Snapshot Store - Published monitor state for read-only consumers
+ * 
+ * The scan pipeline publishes a complete snapshot after every result into
+ * one of two buffers and flips the sequence number; the published buffer
+ * is never written again until it is the back buffer. Readers (display,
+ * chat commands, exports) pin the current buffer with a SnapshotView and
+ * read it in place, with no lock and no copy. The writer never waits: if a
+ * slow reader still pins the back buffer, publish() declines and the
+ * scanner publishes its working copy again on its next pass.
+ */
+class StatusSnapshotStore {
+private:
+  static StatusSnapshot buffers[2];
+  static std::atomic<uint32_t> sequence;    // buffers[sequence & 1] is the published one
+  static std::atomic<uint8_t> readers[2];   // views pinning each buffer
+  static uint32_t deferred;                 // publishes declined for a pinned back buffer
+  
+public:
+  // Writer side (scanner task only), false if the back buffer is still pinned
+  static bool publish(StatusSnapshot& snapshot);
+  
+  // Reader side, prefer SnapshotView; every acquire() needs its release()
+  static const StatusSnapshot* acquire();
+  static void release(const StatusSnapshot* snapshot);
+  
+  // 0 = nothing published yet
+  static uint32_t getSequence() { return sequence.load(); }
+  static uint32_t getDeferredCount() { return deferred; }
+};
+
+// RAII reader, pins the published snapshot for its scope. Keep it short:
+// a view held across a network call makes the scanner defer its publishes.
+class SnapshotView {
+private:
+  const StatusSnapshot* snapshot;
+  
+public:
+  SnapshotView() : snapshot(StatusSnapshotStore::acquire()) {}
+  ~SnapshotView() { StatusSnapshotStore::release(snapshot); }
+  
+  const StatusSnapshot& operator*() const { return *snapshot; }
+  const StatusSnapshot* operator->() const { return snapshot; }
+  
+  // Disable copy constructor and assignment
+  SnapshotView(const SnapshotView&) = delete;
+  SnapshotView& operator=(const SnapshotView&) = delete;
+};
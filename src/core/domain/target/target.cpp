@@ -4,7 +4,7 @@
 Target::Target(const String& name, const String& url, 
                const String& healthEndpoint, MonitorType type) 
   : name(name), url(url), healthEndpoint(healthEndpoint), 
-    monitorType(type), status(UNKNOWN), latency(0) {
+    monitorType(type), status(UNKNOWN), latency(0), parentIndex(-1) {
 }
 
 String Target::getStatusText() const {
@@ -12,11 +12,16 @@ String Target::getStatusText() const {
     case UP: return "UP";
     case DOWN: return "DOWN";
     case UNKNOWN: return "UNKNOWN";
+    case UNREACHABLE: return "UNREACHABLE";
     default: return "ERROR";
   }
 }
 
 String Target::getLatencyText() const {
+  if (status == UNREACHABLE) {
+    return "UNREACH";
+  }
+  
   if (status != UP || latency == 0) {
     return monitorType == HEALTH_CHECK ? "FAIL" : "DOWN";
   }
@@ -10,6 +10,7 @@ private:
   MonitorType monitorType;
   Status status;
   uint16_t latency;
+  int8_t parentIndex; // -1 = no parent
   
 public:
   // Constructor
@@ -23,6 +24,7 @@ public:
   MonitorType getMonitorType() const { return monitorType; }
   Status getStatus() const { return status; }
   uint16_t getLatency() const { return latency; }
+  int8_t getParentIndex() const { return parentIndex; }
   
   // Setters
   void setName(const String& n) { name = n; }
@@ -31,11 +33,14 @@ public:
   void setMonitorType(MonitorType mt) { monitorType = mt; }
   void setStatus(Status s) { status = s; }
   void setLatency(uint16_t l) { latency = l; }
+  void setParentIndex(int8_t p) { parentIndex = p; }
   
   // Business logic
   bool isHealthy() const { return status == UP; }
   bool isDown() const { return status == DOWN; }
   bool isUnknown() const { return status == UNKNOWN; }
+  bool isUnreachable() const { return status == UNREACHABLE; }
+  bool hasParent() const { return parentIndex >= 0; }
   
   String getStatusText() const;
   String getLatencyText() const;
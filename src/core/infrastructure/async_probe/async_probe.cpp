@@ -0,0 +1,346 @@
+#include "core/infrastructure/async_probe/async_probe.h"
+#include "core/infrastructure/dns_cache/dns_cache.h"
+#include "core/infrastructure/logger/logger.h"
+#include <WiFi.h>
+
+// Static member definitions
+AsyncProbePool::Probe AsyncProbePool::probes[MAX_PROBES];
+uint8_t AsyncProbePool::slotCount = 0;
+uint8_t AsyncProbePool::activeCount = 0;
+AsyncProbePool::Stats AsyncProbePool::stats = {};
+
+void AsyncProbePool::initialize(int slots) {
+  cleanup();
+  memset(&stats, 0, sizeof(stats));
+
+  // Each slot holds a socket; leave room for the workers (or the scanner's own probe) and the services
+  uint8_t workers = ProbeWorkerPool::getWorkerCount();
+  int budget = SOCKET_BUDGET - RESERVED_SOCKETS - (workers > 0 ? workers : 1);
+  if (budget < 0) budget = 0;
+  if (slots > budget) {
+    Serial_printf("[ASYNC_PROBE] WARNING: %d slot(s) requested, lwIP has sockets for %d\n", slots, budget);
+    slots = budget;
+  }
+  slotCount = slots > 0 ? (uint8_t)slots : 0;
+
+  if (slotCount == 0) {
+    Serial_println("[ASYNC_PROBE] Disabled, every probe runs on the workers");
+    return;
+  }
+  Serial_printf("[ASYNC_PROBE] %u slot(s) for plain HTTP probes, %u bytes each\n", slotCount,
+                (unsigned)sizeof(Probe));
+}
+
+void AsyncProbePool::cleanup() {
+  for (uint8_t i = 0; i < MAX_PROBES; i++) {
+    if (probes[i].state != IDLE) closeSocket(probes[i]);
+    probes[i].state = IDLE;
+    probes[i].sock = -1;
+  }
+  activeCount = 0;
+}
+
+bool AsyncProbePool::submit(int targetIndex, const String& url) {
+  if (!isEnabled() || !url.startsWith("http://")) return false;
+
+  Probe* probe = nullptr;
+  for (uint8_t i = 0; i < slotCount; i++) {
+    if (probes[i].state == IDLE) {
+      probe = &probes[i];
+      break;
+    }
+  }
+  if (!probe) return false;
+
+  int pathStart = url.indexOf('/', 7);
+  int pathLength = pathStart < 0 ? 1 : url.length() - pathStart;
+  if (pathLength >= (int)sizeof(probe->path) ||
+      !DnsCache::parseUrl(url, probe->host, sizeof(probe->host), probe->port)) {
+    return false;   // the worker path copes with it
+  }
+  strcpy(probe->path, pathStart < 0 ? "/" : url.c_str() + pathStart);
+
+  uint32_t now = millis();
+  probe->targetIndex = (int8_t)targetIndex;
+  probe->attempt = 0;
+  probe->skipped = false;
+  probe->sock = -1;
+  probe->latency = 0;
+  probe->startedAt = now;
+
+  activeCount++;
+  if (!startAttempt(*probe, now)) {
+    // Out of sockets: give the slot back, a worker runs this one
+    probe->state = IDLE;
+    activeCount--;
+    return false;
+  }
+
+  stats.submitted++;
+  if (activeCount > stats.peakActive) stats.peakActive = activeCount;
+  return true;
+}
+
+bool AsyncProbePool::takeResult(ProbeResult& result) {
+  for (uint8_t i = 0; i < slotCount; i++) {
+    Probe& probe = probes[i];
+    if (probe.state != DONE) continue;
+
+    result.targetIndex = probe.targetIndex;
+    result.workerId = WORKER_ID;
+    result.latency = probe.latency;
+    result.durationMs = millis() - probe.startedAt;
+    result.skipped = probe.skipped;
+    probe.state = IDLE;
+    return true;
+  }
+  return false;
+}
+
+int AsyncProbePool::buildFdSets(fd_set& readSet, fd_set& writeSet) {
+  FD_ZERO(&readSet);
+  FD_ZERO(&writeSet);
+  int maxFd = -1;
+  for (uint8_t i = 0; i < slotCount; i++) {
+    const Probe& probe = probes[i];
+    if (probe.sock < 0) continue;
+    if (probe.state == CONNECTING || probe.state == SENDING) {
+      FD_SET(probe.sock, &writeSet);
+    } else if (probe.state == RECEIVING) {
+      FD_SET(probe.sock, &readSet);
+    } else {
+      continue;
+    }
+    if (probe.sock > maxFd) maxFd = probe.sock;
+  }
+  return maxFd;
+}
+
+void AsyncProbePool::poll() {
+  if (activeCount == 0) return;
+
+  // One readiness check for every open socket, then one step per probe
+  fd_set readSet, writeSet;
+  int maxFd = buildFdSets(readSet, writeSet);
+  if (maxFd >= 0) {
+    struct timeval zero = {0, 0};
+    if (select(maxFd + 1, &readSet, &writeSet, nullptr, &zero) < 0) {
+      FD_ZERO(&readSet);
+      FD_ZERO(&writeSet);
+    }
+  }
+
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < slotCount; i++) {
+    Probe& probe = probes[i];
+    if (probe.state == IDLE || probe.state == DONE) continue;
+    bool readable = probe.sock >= 0 && FD_ISSET(probe.sock, &readSet);
+    bool writable = probe.sock >= 0 && FD_ISSET(probe.sock, &writeSet);
+    step(probe, readable, writable, now);
+  }
+}
+
+bool AsyncProbePool::waitForIo(uint32_t timeoutMs) {
+  if (activeCount == 0) return false;
+
+  fd_set readSet, writeSet;
+  int maxFd = buildFdSets(readSet, writeSet);
+  if (maxFd < 0) return false;
+
+  // Wake up in time for the earliest attempt deadline or retry
+  uint32_t now = millis();
+  for (uint8_t i = 0; i < slotCount; i++) {
+    const Probe& probe = probes[i];
+    if (probe.state == IDLE || probe.state == DONE) continue;
+    int32_t remaining = (int32_t)(probe.wakeAt - now);
+    if (remaining < 0) remaining = 0;
+    if ((uint32_t)remaining < timeoutMs) timeoutMs = remaining;
+  }
+
+  struct timeval timeout = {(time_t)(timeoutMs / 1000), (suseconds_t)((timeoutMs % 1000) * 1000)};
+  return select(maxFd + 1, &readSet, &writeSet, nullptr, &timeout) >= 0;
+}
+
+bool AsyncProbePool::startAttempt(Probe& probe, uint32_t now) {
+  probe.attemptAt = now;
+  probe.wakeAt = now + ATTEMPT_TIMEOUT_MS;
+  probe.sent = 0;
+  probe.received = 0;
+  probe.status[0] = '\0';
+
+  if (WiFi.status() != WL_CONNECTED) {
+    finishAttempt(probe, -1, now);
+    return true;
+  }
+
+  // Through the shared cache; a miss is the one step that still blocks
+  IPAddress address;
+  if (!DnsCache::resolve(probe.host, address)) {
+    finishAttempt(probe, -1, now);
+    return true;
+  }
+
+  // EMFILE/ENFILE says nothing about the target, the caller decides where the probe goes
+  probe.sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (probe.sock < 0) {
+    Serial_println("[ASYNC_PROBE] WARNING: No free socket");
+    stats.noSocket++;
+    return false;
+  }
+  fcntl(probe.sock, F_SETFL, fcntl(probe.sock, F_GETFL, 0) | O_NONBLOCK);
+
+  struct sockaddr_in server;
+  memset(&server, 0, sizeof(server));
+  server.sin_family = AF_INET;
+  server.sin_port = htons(probe.port);
+  server.sin_addr.s_addr = (uint32_t)address;
+
+  if (connect(probe.sock, (struct sockaddr*)&server, sizeof(server)) == 0) {
+    probe.state = SENDING;
+  } else if (errno == EINPROGRESS) {
+    probe.state = CONNECTING;
+  } else {
+    // The cached address may be stale, look it up again next time
+    DnsCache::invalidate(probe.host);
+    finishAttempt(probe, -1, now);
+  }
+  return true;
+}
+
+void AsyncProbePool::step(Probe& probe, bool readable, bool writable, uint32_t now) {
+  if (probe.state == BACKOFF) {
+    if ((int32_t)(now - probe.wakeAt) >= 0 && !startAttempt(probe, now)) {
+      // Out of sockets mid-retry: no verdict, the monitor requeues the target
+      probe.skipped = true;
+      probe.state = DONE;
+      activeCount--;
+    }
+    return;
+  }
+
+  if (probe.state == CONNECTING && writable) {
+    int error = 0;
+    socklen_t length = sizeof(error);
+    getsockopt(probe.sock, SOL_SOCKET, SO_ERROR, &error, &length);
+    if (error != 0) {
+      DnsCache::invalidate(probe.host);
+      finishAttempt(probe, -1, now);
+      return;
+    }
+    probe.state = SENDING;
+  }
+
+  if (probe.state == SENDING && writable && !sendRequest(probe)) {
+    finishAttempt(probe, -1, now);
+    return;
+  }
+
+  if (probe.state == RECEIVING && readable && readStatus(probe, now)) {
+    return;
+  }
+
+  if ((int32_t)(now - probe.wakeAt) >= 0) {
+    stats.timeouts++;
+    finishAttempt(probe, -1, now);
+  }
+}
+
+bool AsyncProbePool::sendRequest(Probe& probe) {
+  // Rebuilt on every step rather than kept in the probe, it's only needed here
+  char portText[8] = "";
+  if (probe.port != 80) {
+    snprintf(portText, sizeof(portText), ":%u", probe.port);
+  }
+  char request[256];
+  int length = snprintf(request, sizeof(request),
+                        "GET %s HTTP/1.1\r\nHost: %s%s\r\nUser-Agent: NebulaWatch/1.0\r\n"
+                        "Accept: */*\r\nConnection: close\r\n\r\n",
+                        probe.path, probe.host, portText);
+  if (length <= 0 || length >= (int)sizeof(request)) return false;
+
+  int written = send(probe.sock, request + probe.sent, length - probe.sent, 0);
+  if (written < 0) {
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+  }
+  probe.sent += written;
+  if (probe.sent >= length) {
+    probe.state = RECEIVING;
+  }
+  return true;
+}
+
+bool AsyncProbePool::readStatus(Probe& probe, uint32_t now) {
+  int count = recv(probe.sock, probe.status + probe.received, sizeof(probe.status) - 1 - probe.received, 0);
+  if (count < 0) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) return false;
+    finishAttempt(probe, -1, now);
+    return true;
+  }
+  probe.received += count;
+  probe.status[probe.received] = '\0';
+
+  // "HTTP/1.1 200 OK": the code is complete once something follows it
+  const char* code = strchr(probe.status, ' ');
+  bool complete = code && (strchr(code + 1, ' ') || strchr(code + 1, '\r'));
+  if (!complete && count > 0 && probe.received < sizeof(probe.status) - 1) {
+    return false;
+  }
+
+  int httpCode = (code && strncmp(probe.status, "HTTP/", 5) == 0) ? atoi(code + 1) : -1;
+  finishAttempt(probe, httpCode, now);
+  return true;
+}
+
+void AsyncProbePool::finishAttempt(Probe& probe, int httpCode, uint32_t now) {
+  // The body is never read, the status line is all a PING needs
+  closeSocket(probe);
+  uint32_t duration = now - probe.attemptAt;
+  Serial_printf("[ASYNC_PROBE] http://%s%s -> code=%d (%lums)\n", probe.host, probe.path, httpCode,
+                (unsigned long)duration);
+
+  if (httpCode > 0 && httpCode != 400) {
+    if (duration > 65535) duration = 65535;
+    probe.latency = duration > 0 ? (uint16_t)duration : 1;
+    probe.state = DONE;
+    stats.succeeded++;
+    activeCount--;
+    return;
+  }
+
+  // Same categories as HttpClient::shouldRetry: a 4xx is permanent, connection errors are worth a retry
+  bool permanent = httpCode >= 400 && httpCode < 500;
+  if (!permanent && probe.attempt < MAX_RETRIES) {
+    probe.attempt++;
+    stats.retries++;
+    probe.state = BACKOFF;
+    probe.wakeAt = now + BACKOFF_STEP_MS * probe.attempt;
+    Serial_printf("[ASYNC_PROBE] Retry %u/%u for %s\n", probe.attempt, MAX_RETRIES, probe.host);
+    return;
+  }
+
+  probe.latency = 0;
+  probe.state = DONE;
+  stats.failed++;
+  activeCount--;
+}
+
+void AsyncProbePool::closeSocket(Probe& probe) {
+  if (probe.sock >= 0) {
+    close(probe.sock);
+    probe.sock = -1;
+  }
+}
+
+void AsyncProbePool::printStatistics() {
+  Serial_println("\n=== ASYNC PROBES ===");
+  if (!isEnabled()) {
+    Serial_println("Disabled (every probe runs on the workers)");
+  } else {
+    Serial_printf("Slots: %u x %u bytes | In flight: %u | Peak: %u\n", slotCount, (unsigned)sizeof(Probe),
+                  activeCount, stats.peakActive);
+    Serial_printf("Submitted: %lu | Up: %lu | Failed: %lu | Retries: %lu | Timeouts: %lu | No socket: %lu\n",
+                  (unsigned long)stats.submitted, (unsigned long)stats.succeeded, (unsigned long)stats.failed,
+                  (unsigned long)stats.retries, (unsigned long)stats.timeouts, (unsigned long)stats.noSocket);
+  }
+  Serial_println("====================\n");
+}
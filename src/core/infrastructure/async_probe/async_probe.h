@@ -0,0 +1,107 @@
+#pragma once
+#include "core/infrastructure/probe_worker_pool/probe_worker_pool.h"
+#include <lwip/sockets.h>
+#include <Arduino.h>
+
+/**
+ * @brief Async Probe Pool - Plain HTTP probes multiplexed on the scanner task
+ *
+ * Each probe is a small resumable state machine (connect, send, read the
+ * status line, back off and retry) over a non-blocking socket. poll()
+ * advances every probe whose socket is ready and returns at once, so
+ * one task keeps many probes in flight for a few hundred bytes of state
+ * each instead of a worker stack apiece. Only http:// PING probes fit:
+ * TLS handshakes and health-check bodies stay on the worker pool.
+ * Results use the worker pool's ProbeResult. Scanner task only.
+ */
+class AsyncProbePool {
+public:
+#ifdef CONFIG_LWIP_MAX_SOCKETS
+  static const uint8_t SOCKET_BUDGET = CONFIG_LWIP_MAX_SOCKETS;
+#else
+  static const uint8_t SOCKET_BUDGET = 10;   // lwIP default
+#endif
+  // Sockets kept for Telegram/webhooks, syslog, NTP and DNS, plus one per worker
+  static const uint8_t RESERVED_SOCKETS = 4;
+  static const uint8_t MAX_PROBES = SOCKET_BUDGET;
+  static const uint8_t WORKER_ID = 0xFF;   // ProbeResult::workerId of these results
+
+  struct Stats {
+    uint32_t submitted;
+    uint32_t succeeded;
+    uint32_t failed;
+    uint32_t retries;
+    uint32_t timeouts;   // attempts that hit the deadline
+    uint32_t noSocket;   // attempts that found every lwIP socket taken
+    uint8_t peakActive;
+  };
+
+private:
+  enum State : uint8_t {
+    IDLE,
+    CONNECTING,   // waits for the socket to become writable
+    SENDING,      // waits for room in the send buffer
+    RECEIVING,    // waits for the status line
+    BACKOFF,      // waits for the next attempt
+    DONE          // result ready for takeResult()
+  };
+
+  // Everything a probe keeps between steps, no stack of its own
+  struct Probe {
+    State state;
+    int8_t targetIndex;
+    uint8_t attempt;
+    bool skipped;           // ran out of sockets, no verdict
+    int sock;
+    uint16_t port;
+    uint16_t sent;          // request bytes already sent
+    uint8_t received;       // status line bytes already read
+    uint16_t latency;       // 0 = failed
+    uint32_t startedAt;     // first attempt, for the result duration
+    uint32_t attemptAt;     // current attempt, for the latency
+    uint32_t wakeAt;        // deadline (I/O states) or next attempt (BACKOFF)
+    char host[64];
+    char path[96];
+    char status[16];        // "HTTP/1.1 200 "
+  };
+
+  static Probe probes[MAX_PROBES];
+  static uint8_t slotCount;
+  static uint8_t activeCount;
+  static Stats stats;
+
+  // Same per-attempt cap and retry schedule as HttpClient
+  static const uint32_t ATTEMPT_TIMEOUT_MS = 8000;
+  static const uint8_t MAX_RETRIES = 2;
+  static const uint32_t BACKOFF_STEP_MS = 1000;
+
+public:
+  // Initialization (slots 0 leaves every probe on the workers), after ProbeWorkerPool
+  static void initialize(int slots);
+  static void cleanup();
+
+  // Scanner side: false if the URL isn't plain http, every slot is busy or no socket is free
+  static bool submit(int targetIndex, const String& url);
+  static bool takeResult(ProbeResult& result);
+
+  // Advances every probe that can make progress, never blocks
+  static void poll();
+
+  // Sleeps until a probe socket is ready or timeoutMs passes, false (no wait) if none is open
+  static bool waitForIo(uint32_t timeoutMs);
+
+  // Status
+  static bool isEnabled() { return slotCount > 0; }
+  static uint8_t getActiveCount() { return activeCount; }
+  static const Stats& getStats() { return stats; }
+  static void printStatistics();
+
+private:
+  static int buildFdSets(fd_set& readSet, fd_set& writeSet);
+  static bool startAttempt(Probe& probe, uint32_t now);
+  static void step(Probe& probe, bool readable, bool writable, uint32_t now);
+  static bool sendRequest(Probe& probe);
+  static bool readStatus(Probe& probe, uint32_t now);
+  static void finishAttempt(Probe& probe, int httpCode, uint32_t now);
+  static void closeSocket(Probe& probe);
+};
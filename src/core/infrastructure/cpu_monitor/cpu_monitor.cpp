@@ -0,0 +1,205 @@
+#include "core/infrastructure/cpu_monitor/cpu_monitor.h"
+#include "core/infrastructure/logger/logger.h"
+#include "esp_freertos_hooks.h"
+#include "esp_timer.h"
+
+// Static member definitions
+CpuMonitor::Sample CpuMonitor::samples[WINDOW_SAMPLES];
+uint8_t CpuMonitor::sampleHead = 0;
+uint8_t CpuMonitor::sampleCount = 0;
+CpuMonitor::TaskLoad CpuMonitor::taskLoads[MAX_TASKS];
+uint8_t CpuMonitor::taskLoadCount = 0;
+uint16_t CpuMonitor::coreLoad[portNUM_PROCESSORS];
+portMUX_TYPE CpuMonitor::lock = portMUX_INITIALIZER_UNLOCKED;
+volatile uint64_t CpuMonitor::idleUs[portNUM_PROCESSORS];
+volatile int64_t CpuMonitor::lastIdleCall[portNUM_PROCESSORS];
+uint32_t CpuMonitor::sampleInterval = 2000;
+uint32_t CpuMonitor::lastSampleAt = 0;
+bool CpuMonitor::initialized = false;
+
+#if configUSE_TRACE_FACILITY
+// Scratch for uxTaskGetSystemState(), only touched by update()
+static TaskStatus_t taskStatus[CpuMonitor::MAX_TASKS];
+#endif
+
+bool CpuMonitor::initialize(uint32_t sampleIntervalMs) {
+  if (initialized) return true;
+
+  sampleInterval = sampleIntervalMs < 500 ? 500 : sampleIntervalMs;
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    coreLoad[core] = NO_DATA;
+    idleUs[core] = 0;
+    lastIdleCall[core] = 0;
+  }
+
+#if !configGENERATE_RUN_TIME_STATS
+  // No run-time counters in this FreeRTOS build: time the idle loops instead
+  esp_register_freertos_idle_hook_for_cpu(idleHookCore0, 0);
+  esp_register_freertos_idle_hook_for_cpu(idleHookCore1, 1);
+  Serial_println("[CPU] Run-time stats unavailable, estimating core load from idle time");
+#endif
+
+  initialized = true;
+  Serial_printf("[CPU] Sampling every %lums over a %u-sample window\n", (unsigned long)sampleInterval, WINDOW_SAMPLES);
+  return true;
+}
+
+void CpuMonitor::update() {
+  if (!initialized) return;
+
+  uint32_t now = millis();
+  if (sampleCount > 0 && now - lastSampleAt < sampleInterval) return;
+  lastSampleAt = now;
+
+  takeSample();
+}
+
+void CpuMonitor::accountIdle(int core) {
+  // Back-to-back idle loops (at most a tick apart, waiting for the next
+  // interrupt) count as idle; a longer gap means other tasks ran
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&lock);
+  int64_t gap = now - lastIdleCall[core];
+  if (gap < (int64_t)portTICK_PERIOD_MS * 1500) {
+    idleUs[core] += gap;
+  }
+  lastIdleCall[core] = now;
+  portEXIT_CRITICAL(&lock);
+}
+
+bool CpuMonitor::idleHookCore0() {
+  accountIdle(0);
+  return true;   // let the core wait for the next interrupt
+}
+
+bool CpuMonitor::idleHookCore1() {
+  accountIdle(1);
+  return true;
+}
+
+void CpuMonitor::takeSample() {
+  Sample& sample = samples[sampleHead];
+  sample.timeUs = esp_timer_get_time();
+  portENTER_CRITICAL(&lock);
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    sample.idleUs[core] = idleUs[core];
+  }
+  portEXIT_CRITICAL(&lock);
+
+  sample.count = 0;
+  sample.totalRunTime = 0;
+  UBaseType_t taskCount = 0;
+#if configUSE_TRACE_FACILITY
+  uint32_t totalRunTime = 0;
+  taskCount = uxTaskGetSystemState(taskStatus, MAX_TASKS, &totalRunTime);
+  sample.totalRunTime = totalRunTime;
+  sample.count = taskCount;
+  for (UBaseType_t i = 0; i < taskCount; i++) {
+    sample.taskNumber[i] = taskStatus[i].xTaskNumber;
+    sample.runTime[i] = taskStatus[i].ulRunTimeCounter;
+  }
+#endif
+
+  if (sampleCount < WINDOW_SAMPLES) sampleCount++;
+  const Sample& oldest = samples[(sampleHead + WINDOW_SAMPLES - (sampleCount - 1)) % WINDOW_SAMPLES];
+  sampleHead = (sampleHead + 1) % WINDOW_SAMPLES;
+  if (sampleCount < 2) return;
+
+  TaskLoad loads[MAX_TASKS];
+  uint16_t cores[portNUM_PROCESSORS];
+
+  // Idle-hook estimate, replaced below by the idle tasks' own counters if present
+  uint64_t elapsedUs = (uint64_t)(sample.timeUs - oldest.timeUs);
+  for (int core = 0; core < portNUM_PROCESSORS; core++) {
+    uint64_t idle = sample.idleUs[core] - oldest.idleUs[core];
+    cores[core] = elapsedUs > 0 && idle < elapsedUs ? (uint16_t)(1000 - idle * 1000 / elapsedUs) : 0;
+  }
+
+#if configUSE_TRACE_FACILITY
+#if configGENERATE_RUN_TIME_STATS
+  // Counters are per task on one core's timebase, so shares are of one core
+  uint32_t windowRunTime = sample.totalRunTime - oldest.totalRunTime;
+#endif
+  for (UBaseType_t i = 0; i < taskCount; i++) {
+    const TaskStatus_t& status = taskStatus[i];
+    TaskLoad& load = loads[i];
+    strncpy(load.name, status.pcTaskName, sizeof(load.name) - 1);
+    load.name[sizeof(load.name) - 1] = '\0';
+    load.priority = status.uxCurrentPriority;
+    load.stackFree = status.usStackHighWaterMark * sizeof(StackType_t);
+    BaseType_t affinity = xTaskGetAffinity(status.xHandle);
+    load.core = affinity == tskNO_AFFINITY ? -1 : (int8_t)affinity;
+    load.permille = NO_DATA;
+
+#if configGENERATE_RUN_TIME_STATS
+    if (windowRunTime == 0) continue;
+
+    // A task missing from the oldest sample was created within the window
+    uint32_t base = 0;
+    for (uint8_t j = 0; j < oldest.count; j++) {
+      if (oldest.taskNumber[j] == status.xTaskNumber) {
+        base = oldest.runTime[j];
+        break;
+      }
+    }
+    uint64_t share = (uint64_t)(status.ulRunTimeCounter - base) * 1000 / windowRunTime;
+    load.permille = share > 1000 ? 1000 : (uint16_t)share;
+
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+      if (status.xHandle == xTaskGetIdleTaskHandleForCPU(core)) {
+        cores[core] = 1000 - load.permille;
+      }
+    }
+#endif
+  }
+#endif
+
+  portENTER_CRITICAL(&lock);
+  memcpy(taskLoads, loads, taskCount * sizeof(TaskLoad));
+  taskLoadCount = taskCount;
+  memcpy(coreLoad, cores, sizeof(coreLoad));
+  portEXIT_CRITICAL(&lock);
+}
+
+uint16_t CpuMonitor::getCoreLoad(int core) {
+  if (core < 0 || core >= portNUM_PROCESSORS) return NO_DATA;
+  portENTER_CRITICAL(&lock);
+  uint16_t load = coreLoad[core];
+  portEXIT_CRITICAL(&lock);
+  return load;
+}
+
+uint8_t CpuMonitor::getTaskLoads(TaskLoad* out, uint8_t max) {
+  portENTER_CRITICAL(&lock);
+  uint8_t count = taskLoadCount < max ? taskLoadCount : max;
+  memcpy(out, taskLoads, count * sizeof(TaskLoad));
+  portEXIT_CRITICAL(&lock);
+  return count;
+}
+
+void CpuMonitor::printStatistics() {
+  Serial_println("\n=== CPU UTILIZATION ===");
+  uint16_t core0 = getCoreLoad(0);
+  uint16_t core1 = getCoreLoad(1);
+  if (core0 == NO_DATA) {
+    Serial_println("Collecting first window...");
+    Serial_println("=======================\n");
+    return;
+  }
+  Serial_printf("Core 0: %u.%u%% | Core 1: %u.%u%% (last %lus)\n", core0 / 10, core0 % 10, core1 / 10, core1 % 10,
+                (unsigned long)(sampleInterval * (sampleCount - 1) / 1000));
+
+  static TaskLoad loads[MAX_TASKS];
+  uint8_t count = getTaskLoads(loads, MAX_TASKS);
+  for (uint8_t i = 0; i < count; i++) {
+    const TaskLoad& load = loads[i];
+    if (load.permille == NO_DATA) {
+      Serial_printf("%-16s core %2d prio %2u    cpu n/a  stack free %lu\n", load.name, load.core, load.priority,
+                    (unsigned long)load.stackFree);
+    } else {
+      Serial_printf("%-16s core %2d prio %2u  cpu %3u.%u%%  stack free %lu\n", load.name, load.core, load.priority,
+                    load.permille / 10, load.permille % 10, (unsigned long)load.stackFree);
+    }
+  }
+  Serial_println("=======================\n");
+}
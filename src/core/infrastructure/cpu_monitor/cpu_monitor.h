@@ -0,0 +1,75 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <Arduino.h>
+
+/**
+ * @brief CPU Monitor - Per-task and per-core CPU utilization over a sliding window
+ *
+ * Samples the FreeRTOS run-time counters every interval and reports each
+ * task's share of one core over the last WINDOW_SAMPLES intervals, plus its
+ * stack headroom. Core load is the complement of that core's idle task.
+ * Without run-time stats in the FreeRTOS build, core load is estimated from
+ * idle-hook timing instead and per-task CPU reads as unavailable.
+ */
+class CpuMonitor {
+public:
+  static const uint8_t MAX_TASKS = 24;
+  static const uint8_t WINDOW_SAMPLES = 6;
+  static const uint16_t NO_DATA = 0xFFFF;
+
+  struct TaskLoad {
+    char name[configMAX_TASK_NAME_LEN];
+    int8_t core;           // -1 = no affinity
+    uint8_t priority;
+    uint16_t permille;     // share of one core over the window, NO_DATA if unknown
+    uint32_t stackFree;    // bytes never used (high-water mark)
+  };
+
+private:
+  struct Sample {
+    int64_t timeUs;
+    uint64_t idleUs[portNUM_PROCESSORS];   // idle-hook estimate
+    uint32_t totalRunTime;
+    uint8_t count;
+    uint32_t taskNumber[MAX_TASKS];
+    uint32_t runTime[MAX_TASKS];
+  };
+
+  static Sample samples[WINDOW_SAMPLES];
+  static uint8_t sampleHead;
+  static uint8_t sampleCount;
+
+  // Published results, copied under the lock
+  static TaskLoad taskLoads[MAX_TASKS];
+  static uint8_t taskLoadCount;
+  static uint16_t coreLoad[portNUM_PROCESSORS];
+  static portMUX_TYPE lock;
+
+  // Idle-hook accounting (written by the idle tasks)
+  static volatile uint64_t idleUs[portNUM_PROCESSORS];
+  static volatile int64_t lastIdleCall[portNUM_PROCESSORS];
+
+  static uint32_t sampleInterval;
+  static uint32_t lastSampleAt;
+  static bool initialized;
+
+public:
+  // Initialization
+  static bool initialize(uint32_t sampleIntervalMs);
+
+  // Takes a sample when the interval has elapsed (call periodically)
+  static void update();
+
+  // Results
+  static uint16_t getCoreLoad(int core);   // permille, NO_DATA until the first window
+  static uint8_t getTaskLoads(TaskLoad* out, uint8_t max);
+  static bool hasPerTaskStats() { return configGENERATE_RUN_TIME_STATS != 0; }
+  static void printStatistics();
+
+private:
+  static void takeSample();
+  static void accountIdle(int core);
+  static bool idleHookCore0();
+  static bool idleHookCore1();
+};
@@ -0,0 +1,191 @@
+#include "core/infrastructure/dns_cache/dns_cache.h"
+#include "core/infrastructure/logger/logger.h"
+
+DnsCache::Entry DnsCache::entries[MAX_ENTRIES];
+DnsCache::Stats DnsCache::stats = {};
+uint32_t DnsCache::ttlMs = 300000;
+uint32_t DnsCache::negativeTtlMs = 30000;
+portMUX_TYPE DnsCache::mux = portMUX_INITIALIZER_UNLOCKED;
+
+void DnsCache::configure(uint32_t ttl, uint32_t negativeTtl) {
+  ttlMs = ttl;
+  negativeTtlMs = negativeTtl;
+  Serial_printf("[DNS] Cache configured: TTL %lums, negative TTL %lums\n",
+               (unsigned long)ttlMs, (unsigned long)negativeTtlMs);
+}
+
+int DnsCache::findEntry(const char* host) {
+  for (int i = 0; i < MAX_ENTRIES; i++) {
+    if (entries[i].used && strcasecmp(entries[i].host, host) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void DnsCache::store(const char* host, uint32_t address, bool negative) {
+  uint32_t now = millis();
+  
+  portENTER_CRITICAL(&mux);
+  
+  // Reuse the host's slot, else a free one, else the least recently used
+  int slot = findEntry(host);
+  for (int i = 0; slot < 0 && i < MAX_ENTRIES; i++) {
+    if (!entries[i].used) slot = i;
+  }
+  if (slot < 0) {
+    slot = 0;
+    for (int i = 1; i < MAX_ENTRIES; i++) {
+      if (now - entries[i].lastUsed > now - entries[slot].lastUsed) slot = i;
+    }
+  }
+  
+  Entry& entry = entries[slot];
+  strncpy(entry.host, host, MAX_HOST_LENGTH - 1);
+  entry.host[MAX_HOST_LENGTH - 1] = '\0';
+  entry.address = address;
+  entry.negative = negative;
+  entry.expiresAt = now + (negative ? negativeTtlMs : ttlMs);
+  entry.lastUsed = now;
+  entry.used = true;
+  
+  portEXIT_CRITICAL(&mux);
+}
+
+bool DnsCache::resolve(const char* host, IPAddress& address) {
+  if (!host || !*host) return false;
+  
+  // IP literals never touch the resolver
+  if (address.fromString(host)) {
+    return true;
+  }
+  
+  // Names too long for the table are resolved every time
+  bool cacheable = strlen(host) < MAX_HOST_LENGTH;
+  uint32_t now = millis();
+  
+  if (cacheable) {
+    portENTER_CRITICAL(&mux);
+    stats.lookups++;
+    int slot = findEntry(host);
+    if (slot >= 0 && (int32_t)(entries[slot].expiresAt - now) > 0) {
+      Entry& entry = entries[slot];
+      entry.lastUsed = now;
+      bool negative = entry.negative;
+      uint32_t cached = entry.address;
+      if (negative) {
+        stats.negativeHits++;
+      } else {
+        stats.hits++;
+      }
+      portEXIT_CRITICAL(&mux);
+      
+      if (negative) return false;
+      address = IPAddress(cached);
+      return true;
+    }
+    stats.misses++;
+    portEXIT_CRITICAL(&mux);
+  }
+  
+  // Network lookup outside the lock, it can take seconds
+  unsigned long startTime = millis();
+  bool ok = WiFi.hostByName(host, address) == 1 && (uint32_t)address != 0;
+  uint32_t elapsed = millis() - startTime;
+  
+  portENTER_CRITICAL(&mux);
+  stats.resolveTimeMs += elapsed;
+  if (!ok) stats.failures++;
+  portEXIT_CRITICAL(&mux);
+  
+  if (!ok) {
+    Serial_printf("[DNS] Lookup failed for %s (%lums)\n", host, (unsigned long)elapsed);
+  }
+  
+  if (cacheable) {
+    store(host, ok ? (uint32_t)address : 0, !ok);
+  }
+  return ok;
+}
+
+void DnsCache::invalidate(const char* host) {
+  portENTER_CRITICAL(&mux);
+  int slot = findEntry(host);
+  if (slot >= 0) {
+    entries[slot].used = false;
+  }
+  portEXIT_CRITICAL(&mux);
+}
+
+bool DnsCache::connect(WiFiClient& client, const char* host, uint16_t port) {
+  IPAddress address;
+  if (!resolve(host, address)) return false;
+  
+  if (!client.connect(address, port)) {
+    // The cached address may be stale, look it up again next time
+    invalidate(host);
+    return false;
+  }
+  return true;
+}
+
+bool DnsCache::connect(WiFiClientSecure& client, const char* host, uint16_t port) {
+  IPAddress address;
+  if (!resolve(host, address)) return false;
+  
+  // Host name still goes out as SNI
+  if (!client.connect(address, port, host, nullptr, nullptr, nullptr)) {
+    invalidate(host);
+    return false;
+  }
+  return true;
+}
+
+bool DnsCache::parseUrl(const String& url, char* host, size_t hostSize, uint16_t& port) {
+  int start = url.indexOf("://");
+  if (start < 0) return false;
+  
+  bool https = url.startsWith("https");
+  start += 3;
+  
+  int end = start;
+  while (end < (int)url.length() && url.charAt(end) != '/' && url.charAt(end) != ':' &&
+         url.charAt(end) != '?') {
+    end++;
+  }
+  
+  size_t length = end - start;
+  if (length == 0 || length >= hostSize) return false;
+  memcpy(host, url.c_str() + start, length);
+  host[length] = '\0';
+  
+  port = https ? 443 : 80;
+  if (end < (int)url.length() && url.charAt(end) == ':') {
+    long explicitPort = atol(url.c_str() + end + 1);
+    if (explicitPort <= 0 || explicitPort > 65535) return false;
+    port = (uint16_t)explicitPort;
+  }
+  return true;
+}
+
+DnsCache::Stats DnsCache::getStats() {
+  portENTER_CRITICAL(&mux);
+  Stats copy = stats;
+  portEXIT_CRITICAL(&mux);
+  return copy;
+}
+
+uint32_t DnsCache::getAverageResolveMs() {
+  Stats current = getStats();
+  return current.misses > 0 ? current.resolveTimeMs / current.misses : 0;
+}
+
+void DnsCache::printStatistics() {
+  Stats current = getStats();
+  uint32_t answered = current.hits + current.negativeHits;
+  Serial_printf("[DNS] Lookups: %lu | Hits: %lu (+%lu negative) | Misses: %lu | Failures: %lu | Hit rate: %lu%% | Avg lookup: %lums | Saved: ~%lums\n",
+               (unsigned long)current.lookups, (unsigned long)current.hits, (unsigned long)current.negativeHits,
+               (unsigned long)current.misses, (unsigned long)current.failures,
+               current.lookups > 0 ? (unsigned long)(answered * 100 / current.lookups) : 0UL,
+               (unsigned long)getAverageResolveMs(), (unsigned long)(answered * getAverageResolveMs()));
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include "freertos/FreeRTOS.h"
+
+/**
+ * @brief DNS Cache - Shared host name resolution with positive and negative caching
+ * 
+ * Probes, Telegram, NTP and syslog resolve through one small table instead
+ * of a lookup per request (each one a round trip to the configured resolver).
+ * Failed lookups are cached too, so a dead host name fails fast. The Arduino
+ * resolver does not expose record TTLs, so entries expire after configurable
+ * positive/negative lifetimes. Safe to call from any task.
+ */
+class DnsCache {
+public:
+  struct Stats {
+    uint32_t lookups;        // resolve() calls for host names (IP literals excluded)
+    uint32_t hits;
+    uint32_t negativeHits;   // answered "no such host" from the cache
+    uint32_t misses;         // went to the network
+    uint32_t failures;       // network lookups that failed
+    uint32_t resolveTimeMs;  // total time spent in network lookups
+  };
+  
+private:
+  static const uint8_t MAX_ENTRIES = 12;
+  static const uint8_t MAX_HOST_LENGTH = 64;
+  
+  struct Entry {
+    char host[MAX_HOST_LENGTH];
+    uint32_t address;
+    uint32_t expiresAt;      // millis()
+    uint32_t lastUsed;       // millis(), for LRU replacement
+    bool used;
+    bool negative;
+  };
+  
+  static Entry entries[MAX_ENTRIES];
+  static Stats stats;
+  static uint32_t ttlMs;
+  static uint32_t negativeTtlMs;
+  static portMUX_TYPE mux;
+  
+public:
+  static void configure(uint32_t ttlMs, uint32_t negativeTtlMs);
+  
+  // Resolve a host name or IP literal, false if it can't be resolved
+  static bool resolve(const char* host, IPAddress& address);
+  
+  // Drop a cached answer, e.g. after connecting to it failed
+  static void invalidate(const char* host);
+  
+  // Connect a client through the cache. HTTPClient reuses an already
+  // connected client, so begin(client, url) after this skips its own lookup.
+  static bool connect(WiFiClient& client, const char* host, uint16_t port);
+  static bool connect(WiFiClientSecure& client, const char* host, uint16_t port);
+  
+  // Split http(s)://host[:port]/... into host and port
+  static bool parseUrl(const String& url, char* host, size_t hostSize, uint16_t& port);
+  
+  // Statistics
+  static Stats getStats();
+  static uint32_t getAverageResolveMs();
+  static void printStatistics();
+  
+private:
+  static int findEntry(const char* host);
+  static void store(const char* host, uint32_t address, bool negative);
+};
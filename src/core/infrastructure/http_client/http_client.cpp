@@ -1,6 +1,8 @@
 #include "core/infrastructure/http_client/http_client.h"
 #include "config/config_loader/config_loader.h"
 #include "core/infrastructure/memory_manager/memory_manager.h"
+#include "core/infrastructure/dns_cache/dns_cache.h"
+#include "core/infrastructure/tls_budget/tls_budget.h"
 #include "core/infrastructure/logger/logger.h"
 
 HttpClient::HttpClient() {
@@ -22,6 +24,9 @@ HttpClient::HttpClient() {
   metrics.lastLogTime = 0;
   metrics.errorCountSinceLastLog = 0;
   metrics.suppressRepeatedErrors = false;
+  metrics.notModifiedResponses = 0;
+  activeValidators = nullptr;
+  budgetSkipped = false;
   
   initializeClients();
 }
@@ -31,7 +36,7 @@ HttpClient::~HttpClient() {
   cleanupClients();
 }
 
-uint16_t HttpClient::ping(const String& url, uint16_t timeout) {
+uint16_t HttpClient::ping(const String& url, uint16_t timeout, HttpValidators* validators) {
   // Enhanced safety checks
   if (url.length() > 200) {
     Serial_println("[HTTP] ERROR: URL too long for ping");
@@ -41,10 +46,13 @@ uint16_t HttpClient::ping(const String& url, uint16_t timeout) {
   // Calculate intelligent timeout
   uint16_t calculatedTimeout = calculateTimeout(url, timeout);
   
-  return performRequestWithRetry(url, calculatedTimeout, "GET");
+  activeValidators = validators;
+  uint16_t latency = performRequestWithRetry(url, calculatedTimeout, "GET");
+  activeValidators = nullptr;
+  return latency;
 }
 
-uint16_t HttpClient::healthCheck(const String& url, const String& endpoint, uint16_t timeout) {
+uint16_t HttpClient::healthCheck(const String& url, const String& endpoint, uint16_t timeout, HttpValidators* validators) {
   // Enhanced safety checks
   if (url.length() > 200) {
     Serial_println("[HTTP] ERROR: URL too long for health check");
@@ -70,7 +78,15 @@ uint16_t HttpClient::healthCheck(const String& url, const String& endpoint, uint
   // Calculate intelligent timeout for health checks
   uint16_t calculatedTimeout = calculateTimeout(fullUrl, timeout);
   
+  activeValidators = validators;
   uint16_t latency = performRequestWithRetry(fullUrl, calculatedTimeout, "GET");
+  activeValidators = nullptr;
+  
+  if (latency > 0 && lastHttpCode == 304) {
+    // Same body that passed validation last time
+    Serial_printf("[HTTP] Health check successful: %d ms (HTTP 304, unchanged)\n", latency);
+    return latency;
+  }
   
   if (latency > 0) {
     // Check HTTP status code first
@@ -83,6 +99,8 @@ uint16_t HttpClient::healthCheck(const String& url, const String& endpoint, uint
     if (lastResponse.length() > 0 && lastResponse.length() < 1000) {
       if (!isHealthyResponse(lastResponse)) {
         Serial_printf("[HTTP] Health check failed: Unhealthy response detected (HTTP %d)\n", lastHttpCode);
+        // An unhealthy body must be fetched again, never confirmed by a 304
+        if (validators) validators->clear();
         return 0;
       }
     }
@@ -224,6 +242,12 @@ uint16_t HttpClient::performRequest(const String& url, uint16_t timeout, const S
   
   uint32_t startTime = millis();
   int httpCode = -1;
+  budgetSkipped = false;
+  
+  // Resolve through the shared cache; unparseable URLs fall back to HTTPClient's own lookup
+  char host[64];
+  uint16_t port = 0;
+  bool parsed = DnsCache::parseUrl(url, host, sizeof(host), port);
   
   // Clear last response to free memory
   lastResponse = "";
@@ -231,33 +255,22 @@ uint16_t HttpClient::performRequest(const String& url, uint16_t timeout, const S
   lastHttpCode = -1;
   
   if (isHttpsUrl(url)) {
+    // Declared first so the slot is returned after the client frees its buffers
+    TlsSlot tlsSlot(TlsBudget::PRIORITY_PROBE, timeout);
+    if (!tlsSlot.isHeld()) {
+      // Nothing was sent, this says nothing about the target
+      budgetSkipped = true;
+      Serial_printf("[HTTP] %s skipped, no TLS session slot\n", url.c_str());
+      return 0;
+    }
+    
     WiFiClientSecure client;
     setupSecureClient(client, url);
     client.setTimeout((timeout + 999) / 1000);
     
-    if (http.begin(client, url)) {
-      setupHeaders(url);
-      if (method == "GET") {
-        httpCode = http.GET();
-      } else if (method == "POST") {
-        http.addHeader("Content-Type", "application/json");
-        httpCode = http.POST(data);
-      }
-      
-      if (httpCode > 0) {
-        // Limit response size to prevent memory issues
-        String response = http.getString();
-        if (response.length() > 2000) {
-          lastResponse = response.substring(0, 2000) + "...";
-          Serial_println("[HTTP] WARNING: Response truncated due to size");
-        } else {
-          lastResponse = response;
-        }
-        
-        // Force cleanup of temporary response
-        response = "";
-        response.reserve(0);
-      }
+    // HTTPClient reuses the socket opened to the cached address
+    if ((!parsed || DnsCache::connect(client, host, port)) && http.begin(client, url)) {
+      httpCode = executeRequest(url, method, data);
       http.end();
     }
     
@@ -282,29 +295,9 @@ uint16_t HttpClient::performRequest(const String& url, uint16_t timeout, const S
     WiFiClient client;
     client.setTimeout((timeout + 999) / 1000);
     
-    if (http.begin(client, url)) {
-      setupHeaders(url);
-      if (method == "GET") {
-        httpCode = http.GET();
-      } else if (method == "POST") {
-        http.addHeader("Content-Type", "application/json");
-        httpCode = http.POST(data);
-      }
-      
-      if (httpCode > 0) {
-        // Limit response size to prevent memory issues
-        String response = http.getString();
-        if (response.length() > 2000) {
-          lastResponse = response.substring(0, 2000) + "...";
-          Serial_println("[HTTP] WARNING: Response truncated due to size");
-        } else {
-          lastResponse = response;
-        }
-        
-        // Force cleanup of temporary response
-        response = "";
-        response.reserve(0);
-      }
+    // HTTPClient reuses the socket opened to the cached address
+    if ((!parsed || DnsCache::connect(client, host, port)) && http.begin(client, url)) {
+      httpCode = executeRequest(url, method, data);
       http.end();
     }
   }
@@ -323,6 +316,68 @@ uint16_t HttpClient::performRequest(const String& url, uint16_t timeout, const S
   return 0;
 }
 
+int HttpClient::executeRequest(const String& url, const String& method, const String& data) {
+  setupHeaders(url);
+  
+  // Conditional GET: an unchanged resource answers 304 without a body
+  bool conditional = method == "GET" && activeValidators && !activeValidators->isEmpty();
+  if (method == "GET" && activeValidators) {
+    static const char* validatorHeaders[] = { "ETag", "Last-Modified" };
+    http.collectHeaders(validatorHeaders, 2);
+    if (activeValidators->etag[0]) {
+      http.addHeader("If-None-Match", activeValidators->etag);
+    }
+    if (activeValidators->lastModified[0]) {
+      http.addHeader("If-Modified-Since", activeValidators->lastModified);
+    }
+  }
+  
+  int httpCode = -1;
+  if (method == "GET") {
+    httpCode = http.GET();
+  } else if (method == "POST") {
+    http.addHeader("Content-Type", "application/json");
+    httpCode = http.POST(data);
+  }
+  
+  if (httpCode == 304 && conditional) {
+    metrics.notModifiedResponses++;
+    return httpCode;
+  }
+  
+  if (httpCode > 0) {
+    // Limit response size to prevent memory issues
+    String response = http.getString();
+    if (response.length() > 2000) {
+      lastResponse = response.substring(0, 2000) + "...";
+      Serial_println("[HTTP] WARNING: Response truncated due to size");
+    } else {
+      lastResponse = response;
+    }
+    
+    // Force cleanup of temporary response
+    response = "";
+    response.reserve(0);
+  }
+  
+  // Remember the validators of a fresh 2xx body, forget them on any other answer
+  if (activeValidators && method == "GET" && httpCode > 0) {
+    activeValidators->clear();
+    if (httpCode >= 200 && httpCode < 300) {
+      String etag = http.header("ETag");
+      String lastModified = http.header("Last-Modified");
+      if (etag.length() < sizeof(activeValidators->etag)) {
+        strcpy(activeValidators->etag, etag.c_str());
+      }
+      if (lastModified.length() < sizeof(activeValidators->lastModified)) {
+        strcpy(activeValidators->lastModified, lastModified.c_str());
+      }
+    }
+  }
+  
+  return httpCode;
+}
+
 bool HttpClient::isHttpsUrl(const String& url) const {
   return url.startsWith("https://");
 }
@@ -465,20 +520,19 @@ uint16_t HttpClient::performRequestWithRetry(const String& url, uint16_t timeout
   uint16_t lastLatency = 0;
   
   while (retryCount <= config.maxRetries) {
-    // Feed watchdog before each request attempt
-    MemoryManager::getInstance().feedWatchdog();
-    
     lastLatency = performRequest(url, timeout, method, data);
     
-    // Feed watchdog after each request attempt
-    MemoryManager::getInstance().feedWatchdog();
-    
     if (lastLatency > 0) {
       // Success
       metrics.successfulRequests++;
       return lastLatency;
     }
     
+    // Not an error of the target: no metrics, no retry, the caller requeues it
+    if (budgetSkipped) {
+      return 0;
+    }
+    
     // Failed - categorize error
     ErrorCategory errorCategory = categorizeError(-1, url); // -1 indicates connection failure
     metrics.lastErrorCategory = errorCategory;
@@ -516,17 +570,39 @@ uint16_t HttpClient::performRequestWithRetry(const String& url, uint16_t timeout
 }
 
 void HttpClient::printMetrics() const {
+  printMetrics(metrics);
+}
+
+void HttpClient::printMetrics(const Metrics& m) {
+  float successRate = m.totalRequests > 0 ? (float)m.successfulRequests / m.totalRequests * 100.0f : 100.0f;
   Serial_println("\n=== HTTP CLIENT METRICS ===");
-  Serial_printf("Total Requests: %lu\n", metrics.totalRequests);
-  Serial_printf("Successful: %lu\n", metrics.successfulRequests);
-  Serial_printf("SSL Errors: %lu\n", metrics.sslErrors);
-  Serial_printf("Timeout Errors: %lu\n", metrics.timeoutErrors);
-  Serial_printf("Success Rate: %.1f%%\n", getSuccessRate());
-  Serial_printf("Last Error Category: %d\n", (int)metrics.lastErrorCategory);
+  Serial_printf("Total Requests: %lu\n", m.totalRequests);
+  Serial_printf("Successful: %lu\n", m.successfulRequests);
+  Serial_printf("SSL Errors: %lu\n", m.sslErrors);
+  Serial_printf("Timeout Errors: %lu\n", m.timeoutErrors);
+  Serial_printf("Not Modified (304): %lu\n", m.notModifiedResponses);
+  Serial_printf("Success Rate: %.1f%%\n", successRate);
+  Serial_printf("Last Error Category: %d\n", (int)m.lastErrorCategory);
   Serial_println("========================\n");
 }
 
+void HttpClient::accumulateMetrics(Metrics& total) const {
+  total.totalRequests += metrics.totalRequests;
+  total.successfulRequests += metrics.successfulRequests;
+  total.sslErrors += metrics.sslErrors;
+  total.timeoutErrors += metrics.timeoutErrors;
+  total.notModifiedResponses += metrics.notModifiedResponses;
+  total.errorCountSinceLastLog += metrics.errorCountSinceLastLog;
+  
+  // Most recent error across the clients
+  if (metrics.lastErrorTime > 0 && (total.lastErrorTime == 0 || (int32_t)(metrics.lastErrorTime - total.lastErrorTime) > 0)) {
+    total.lastErrorTime = metrics.lastErrorTime;
+    total.lastErrorCategory = metrics.lastErrorCategory;
+  }
+}
+
 void HttpClient::resetMetrics() {
+  metrics.notModifiedResponses = 0;
   metrics.totalRequests = 0;
   metrics.successfulRequests = 0;
   metrics.sslErrors = 0;
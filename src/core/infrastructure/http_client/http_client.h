@@ -21,18 +21,24 @@ struct ConnectionConfig {
   const char* userAgent;
 };
 
-class HttpClient {
-private:
-  HTTPClient http;
-  String lastResponse;
-  int lastHttpCode;
+// Cache validators of the last healthy response, owned per target by the caller
+struct HttpValidators {
+  char etag[64];
+  char lastModified[32];
   
+  void clear() { etag[0] = '\0'; lastModified[0] = '\0'; }
+  bool isEmpty() const { return etag[0] == '\0' && lastModified[0] == '\0'; }
+};
+
+class HttpClient {
+public:
   // Performance metrics
   struct Metrics {
     uint32_t totalRequests;
     uint32_t successfulRequests;
     uint32_t sslErrors;
     uint32_t timeoutErrors;
+    uint32_t notModifiedResponses;
     uint32_t lastErrorTime;
     ErrorCategory lastErrorCategory;
     
@@ -40,26 +46,40 @@ private:
     uint32_t lastLogTime;
     uint32_t errorCountSinceLastLog;
     bool suppressRepeatedErrors;
-  } metrics;
+  };
+  
+private:
+  HTTPClient http;
+  String lastResponse;
+  int lastHttpCode;
+  Metrics metrics;
   
   // Connection pooling (simple implementation)
   WiFiClientSecure* secureClient;
   WiFiClient* plainClient;
   bool clientInitialized;
   
+  // Validators of the request in flight (nullptr = unconditional)
+  HttpValidators* activeValidators;
+  
+  // Last request never went out: no TLS session slot (our contention, not the target's)
+  bool budgetSkipped;
+  
 public:
   HttpClient();
   ~HttpClient();
   
   // Basic HTTP operations with enhanced error handling
-  uint16_t ping(const String& url, uint16_t timeout = 0);
-  uint16_t healthCheck(const String& url, const String& endpoint, uint16_t timeout = 0);
+  // With validators the GET is conditional and a 304 counts as success
+  uint16_t ping(const String& url, uint16_t timeout = 0, HttpValidators* validators = nullptr);
+  uint16_t healthCheck(const String& url, const String& endpoint, uint16_t timeout = 0, HttpValidators* validators = nullptr);
   String get(const String& url, uint16_t timeout = 0);
   String post(const String& url, const String& data, uint16_t timeout = 0);
   
   // Response handling
   String getLastResponse() const { return lastResponse; }
   int getLastHttpCode() const { return lastHttpCode; }
+  bool wasSkipped() const { return budgetSkipped; }
   bool isHealthyResponse(const String& response) const;
   
   // Enhanced utility methods
@@ -71,12 +91,18 @@ public:
   void printMetrics() const;
   void resetMetrics();
   float getSuccessRate() const;
+  const Metrics& getMetrics() const { return metrics; }
+  
+  // Totals over several clients (scanner plus probe workers)
+  void accumulateMetrics(Metrics& total) const;
+  static void printMetrics(const Metrics& total);
   ErrorCategory getLastErrorCategory() const { return metrics.lastErrorCategory; }
   
 private:
   // Core request handling with retry logic
   uint16_t performRequest(const String& url, uint16_t timeout, const String& method = "GET", const String& data = "");
   uint16_t performRequestWithRetry(const String& url, uint16_t timeout, const String& method = "GET", const String& data = "");
+  int executeRequest(const String& url, const String& method, const String& data);
   
   // Enhanced SSL/TLS handling
   bool isHttpsUrl(const String& url) const;
@@ -2,6 +2,7 @@
 #include <WiFi.h>
 #include <HTTPClient.h>
 #include "core/infrastructure/logger/logger.h"
+#include "core/infrastructure/task_watchdog/task_watchdog.h"
 
 // Global instance
 MemoryManager& MemoryManager::getInstance() {
@@ -16,33 +17,42 @@ bool MemoryManager::initialize() {
   
   // Initialize state
   initialized = true;
-  watchdogFeedingEnabled = false; // Disabled - full control to us
   lastGCCleanup = 0;
   lastMemoryCheck = 0;
-  lastWatchdogFeed = 0;
   
   // Initialize string pool
   initializeStringPool();
   
   // Create memory monitoring task
-  BaseType_t result = xTaskCreatePinnedToCore(
+  watchdogSlot = TaskWatchdog::registerTask("MemoryMonitor", MONITOR_DEADLINE_MS);
+  if (!startMonitorTask()) {
+    Serial_println("[MEMORY_MANAGER] ERROR: Failed to create memory monitor task!");
+    initialized = false;
+    return false;
+  }
+  
+  Serial_println("[MEMORY_MANAGER] Memory manager initialized successfully!");
+  return true;
+}
+
+bool MemoryManager::startMonitorTask() {
+  BaseType_t result = RtosAlloc::createTask(
     memoryMonitorTask,
     "MemoryMonitor",
     4096,        // 4KB stack
     this,
     1,           // Low priority
     &memoryMonitorTaskHandle,
-    0            // Core 0
+    0,           // Core 0
+    memoryMonitorTaskBuffer
   );
   
   if (result != pdPASS) {
-    Serial_println("[MEMORY_MANAGER] ERROR: Failed to create memory monitor task!");
-    initialized = false;
+    memoryMonitorTaskHandle = nullptr;
     return false;
   }
   
-  Serial_println("[MEMORY_MANAGER] Memory manager initialized successfully!");
-  Serial_println("[MEMORY_MANAGER] WATCHDOG DISABLED - Full control to application");
+  TaskWatchdog::attach(watchdogSlot, memoryMonitorTaskHandle);
   return true;
 }
 
@@ -176,27 +186,6 @@ void MemoryManager::destroyString(String* str) {
   }
 }
 
-void MemoryManager::feedWatchdog() {
-  if (!watchdogFeedingEnabled) return;
-  
-  uint32_t now = millis();
-  if (now - lastWatchdogFeed >= WATCHDOG_FEED_INTERVAL_MS) {
-    // Feed the watchdog by yielding
-    vTaskDelay(pdMS_TO_TICKS(1));
-    lastWatchdogFeed = now;
-  }
-}
-
-void MemoryManager::enableWatchdogFeeding() {
-  watchdogFeedingEnabled = true;
-  Serial_println("[MEMORY_MANAGER] Watchdog feeding enabled");
-}
-
-void MemoryManager::disableWatchdogFeeding() {
-  watchdogFeedingEnabled = false;
-  Serial_println("[MEMORY_MANAGER] Watchdog feeding disabled");
-}
-
 void MemoryManager::handleMemoryPressure() {
   MemoryStats stats = getMemoryStats();
   
@@ -300,8 +289,8 @@ void MemoryManager::memoryMonitorTask(void* parameter) {
       manager->lastMemoryCheck = now;
     }
     
-    // Feed watchdog every second
-    manager->feedWatchdog();
+    // Heartbeat once per loop
+    TaskWatchdog::feed(manager->watchdogSlot);
     
     // Run GC every 30 seconds
     if (now - manager->lastGCCleanup >= GC_INTERVAL_MS) {
@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
 
 /**
  * @brief Memory Manager - Manual Garbage Collection for ESP32
@@ -48,11 +49,6 @@ public:
   String* createString(const String& value);
   void destroyString(String* str);
   
-  // Watchdog management
-  void feedWatchdog();
-  void enableWatchdogFeeding();
-  void disableWatchdogFeeding();
-  
   // Memory pressure management
   void handleMemoryPressure();
   void emergencyCleanup();
@@ -68,17 +64,16 @@ private:
   
   // Internal state
   bool initialized;
-  bool watchdogFeedingEnabled;
   uint32_t lastGCCleanup;
   uint32_t lastMemoryCheck;
-  uint32_t lastWatchdogFeed;
+  int watchdogSlot;
   
   // Memory thresholds
   static const uint32_t LOW_MEMORY_THRESHOLD = 50000;    // 50KB
   static const uint32_t CRITICAL_MEMORY_THRESHOLD = 20000; // 20KB
   static const uint32_t GC_INTERVAL_MS = 120000;         // 2 minutes
   static const uint32_t MEMORY_CHECK_INTERVAL_MS = 5000; // 5 seconds
-  static const uint32_t WATCHDOG_FEED_INTERVAL_MS = 500; // 500ms - more aggressive heartbeat
+  static const uint32_t MONITOR_DEADLINE_MS = 15000;     // watchdog deadline of the monitor loop
   
   // String pool for efficient memory management
   struct StringPool {
@@ -95,7 +90,9 @@ private:
   
   // Memory monitoring tasks
   static void memoryMonitorTask(void* parameter);
+  bool startMonitorTask();
   TaskHandle_t memoryMonitorTaskHandle;
+  RtosAlloc::TaskBuffer memoryMonitorTaskBuffer;
 };
 
 /**
@@ -0,0 +1,291 @@
+#include "core/infrastructure/notification_dispatcher/notification_dispatcher.h"
+#include "core/infrastructure/task_watchdog/task_watchdog.h"
+#include "core/infrastructure/logger/logger.h"
+
+// Static member definitions
+NotificationDispatcher::Channel NotificationDispatcher::channels[MAX_CHANNELS];
+int NotificationDispatcher::channelCount = 0;
+NotificationDispatcher::Delivery NotificationDispatcher::deliveries[MAX_TARGETS];
+QueueHandle_t NotificationDispatcher::receiptQueue = nullptr;
+portMUX_TYPE NotificationDispatcher::deliveryLock = portMUX_INITIALIZER_UNLOCKED;
+TaskHandle_t NotificationDispatcher::task_handle = nullptr;
+RtosAlloc::TaskBuffer NotificationDispatcher::task_buffer = {};
+int NotificationDispatcher::watchdogSlot = -1;
+bool NotificationDispatcher::initialized = false;
+
+bool NotificationDispatcher::registerNotifier(Notifier* notifier) {
+  if (!notifier || channelCount >= MAX_CHANNELS) {
+    Serial_println("[NOTIFY] ERROR: Cannot register notifier!");
+    return false;
+  }
+  
+  if (!notifier->isActive()) {
+    Serial_printf("[NOTIFY] Backend %s disabled, not registered\n", notifier->getName());
+    return false;
+  }
+  
+  // One receipt per target at most is ever outstanding
+  if (!receiptQueue) {
+    receiptQueue = RtosAlloc::createQueue(MAX_TARGETS, sizeof(Receipt));
+    if (!receiptQueue) {
+      Serial_println("[NOTIFY] ERROR: Failed to create receipt queue!");
+      return false;
+    }
+  }
+  
+  Channel& channel = channels[channelCount];
+  channel.queue = RtosAlloc::createQueue(QUEUE_DEPTH, sizeof(NotificationEvent));
+  if (!channel.queue) {
+    Serial_printf("[NOTIFY] ERROR: Failed to create queue for %s!\n", notifier->getName());
+    return false;
+  }
+  
+  channel.notifier = notifier;
+  channel.hasPending = false;
+  channel.attempts = 0;
+  channel.nextAttemptAt = 0;
+  memset(&channel.stats, 0, sizeof(channel.stats));
+  channelCount++;
+  
+  Serial_printf("[NOTIFY] Registered backend: %s\n", notifier->getName());
+  return true;
+}
+
+bool NotificationDispatcher::initialize() {
+  if (initialized) return true;
+  
+  Serial_println("[NOTIFY] Initializing notification dispatcher...");
+  
+  watchdogSlot = TaskWatchdog::registerTask("NotifyTask", TASK_DEADLINE_MS);
+  if (!startTask()) {
+    Serial_println("[NOTIFY] ERROR: Failed to create notification task!");
+    TaskWatchdog::unregisterTask(watchdogSlot);
+    watchdogSlot = -1;
+    return false;
+  }
+  
+  initialized = true;
+  Serial_printf("[NOTIFY] Dispatcher initialized with %d backend(s)\n", channelCount);
+  return true;
+}
+
+bool NotificationDispatcher::startTask() {
+  // Deliveries may involve TLS handshakes, run them on the display core
+  // at low priority so they never compete with the scanner
+  BaseType_t result = RtosAlloc::createTask(
+    notificationTask,
+    "NotifyTask",
+    8192,        // Stack size: 8KB (TLS)
+    nullptr,
+    1,           // Priority: 1 (lowest)
+    &task_handle,
+    1,           // Core 1
+    task_buffer
+  );
+  
+  if (result != pdPASS) {
+    task_handle = nullptr;
+    return false;
+  }
+  
+  TaskWatchdog::attach(watchdogSlot, task_handle);
+  return true;
+}
+
+void NotificationDispatcher::cleanup() {
+  TaskWatchdog::unregisterTask(watchdogSlot);
+  watchdogSlot = -1;
+  
+  if (task_handle) {
+    vTaskDelete(task_handle);
+    task_handle = nullptr;
+  }
+  
+  for (int i = 0; i < channelCount; i++) {
+    if (channels[i].queue) {
+      vQueueDelete(channels[i].queue);
+      channels[i].queue = nullptr;
+    }
+  }
+  
+  if (receiptQueue) {
+    vQueueDelete(receiptQueue);
+    receiptQueue = nullptr;
+  }
+  memset(deliveries, 0, sizeof(deliveries));
+  
+  channelCount = 0;
+  initialized = false;
+}
+
+bool NotificationDispatcher::dispatch(const NotificationEvent& event) {
+  int accepted = 0;
+  bool tracked = event.type == NotificationType::ALERT && event.targetIndex >= 0 && event.targetIndex < MAX_TARGETS;
+  
+  // Armed before queueing: the task may finish a channel before the loop ends
+  if (tracked) {
+    portENTER_CRITICAL(&deliveryLock);
+    deliveries[event.targetIndex].remaining = channelCount;
+    deliveries[event.targetIndex].delivered = false;
+    portEXIT_CRITICAL(&deliveryLock);
+  }
+  
+  for (int i = 0; i < channelCount; i++) {
+    if (xQueueSend(channels[i].queue, &event, 0) == pdTRUE) {
+      accepted++;
+    } else {
+      channels[i].stats.overflow++;
+      Serial_printf("[NOTIFY] WARNING: %s queue full, event dropped\n", channels[i].notifier->getName());
+    }
+  }
+  
+  if (tracked) {
+    if (accepted == 0) {
+      // Nothing queued, the caller keeps the alert and raises it again
+      portENTER_CRITICAL(&deliveryLock);
+      deliveries[event.targetIndex].remaining = 0;
+      portEXIT_CRITICAL(&deliveryLock);
+    } else if (accepted < channelCount) {
+      settleDelivery(event.targetIndex, channelCount - accepted, false);
+    }
+  }
+  
+  if (accepted > 0 && task_handle) {
+    xTaskNotifyGive(task_handle);
+  }
+  
+  return accepted > 0;
+}
+
+void NotificationDispatcher::settleDelivery(int8_t targetIndex, uint8_t channelsDone, bool delivered) {
+  if (targetIndex < 0 || targetIndex >= MAX_TARGETS) return;
+  
+  // Reported on the first success, or once the last channel gave up
+  bool report = false;
+  Receipt receipt = {targetIndex, delivered};
+  
+  portENTER_CRITICAL(&deliveryLock);
+  Delivery& delivery = deliveries[targetIndex];
+  if (delivery.remaining > 0) {
+    report = delivered && !delivery.delivered;
+    delivery.remaining = channelsDone < delivery.remaining ? delivery.remaining - channelsDone : 0;
+    report = report || (delivery.remaining == 0 && !delivery.delivered);
+    delivery.delivered = delivery.delivered || delivered;
+  }
+  portEXIT_CRITICAL(&deliveryLock);
+  
+  if (report && xQueueSend(receiptQueue, &receipt, 0) != pdTRUE) {
+    Serial_printf("[NOTIFY] WARNING: Receipt for target %d dropped\n", targetIndex);
+  }
+}
+
+bool NotificationDispatcher::takeReceipt(Receipt& receipt) {
+  return receiptQueue && xQueueReceive(receiptQueue, &receipt, 0) == pdTRUE;
+}
+
+bool NotificationDispatcher::getChannelStats(int channel, ChannelStats& stats) {
+  if (channel < 0 || channel >= channelCount) return false;
+  stats = channels[channel].stats;
+  return true;
+}
+
+void NotificationDispatcher::printStatistics() {
+  Serial_println("\n=== NOTIFICATION DISPATCHER ===");
+  for (int i = 0; i < channelCount; i++) {
+    const ChannelStats& s = channels[i].stats;
+    Serial_printf("%s: delivered=%lu retries=%lu failed=%lu overflow=%lu queued=%u\n",
+                  channels[i].notifier->getName(),
+                  (unsigned long)s.delivered, (unsigned long)s.retries,
+                  (unsigned long)s.failed, (unsigned long)s.overflow,
+                  (unsigned)uxQueueMessagesWaiting(channels[i].queue));
+  }
+  Serial_println("===============================\n");
+}
+
+uint32_t NotificationDispatcher::serviceChannel(Channel& channel, uint32_t now) {
+  if (!channel.hasPending) {
+    if (xQueueReceive(channel.queue, &channel.pending, 0) != pdTRUE) {
+      return IDLE_WAIT_MS;
+    }
+    channel.hasPending = true;
+    channel.attempts = 0;
+    channel.nextAttemptAt = now;
+  }
+  
+  // Still backing off from a previous failure
+  if ((int32_t)(channel.nextAttemptAt - now) > 0) {
+    return channel.nextAttemptAt - now;
+  }
+  
+  RetryPolicy policy = channel.notifier->getRetryPolicy();
+  channel.attempts++;
+  
+  if (channel.notifier->send(channel.pending)) {
+    channel.stats.delivered++;
+    channel.hasPending = false;
+    if (channel.pending.type == NotificationType::ALERT) {
+      settleDelivery(channel.pending.targetIndex, 1, true);
+    }
+    return 0; // Check the queue again right away
+  }
+  
+  if (channel.attempts >= policy.maxAttempts) {
+    channel.stats.failed++;
+    channel.hasPending = false;
+    Serial_printf("[NOTIFY] %s: giving up on event for %s after %d attempts\n",
+                  channel.notifier->getName(), channel.pending.targetName, channel.attempts);
+    if (channel.pending.type == NotificationType::ALERT) {
+      settleDelivery(channel.pending.targetIndex, 1, false);
+    }
+    return 0;
+  }
+  
+  // Exponential backoff bounded by the backend policy
+  uint32_t backoff = policy.initialBackoffMs << (channel.attempts - 1);
+  if (backoff > policy.maxBackoffMs || backoff < policy.initialBackoffMs) {
+    backoff = policy.maxBackoffMs;
+  }
+  
+  channel.stats.retries++;
+  channel.nextAttemptAt = millis() + backoff;
+  Serial_printf("[NOTIFY] %s: attempt %d failed, retrying in %lums\n",
+                channel.notifier->getName(), channel.attempts, (unsigned long)backoff);
+  return backoff;
+}
+
+void NotificationDispatcher::notificationTask(void* pv) {
+  Serial_println("[NOTIFY_TASK] Started on Core 1");
+  
+  for (;;) {
+    TaskWatchdog::feed(watchdogSlot);
+    
+    uint32_t wait = processOnce();
+    
+    // Sleep until a new event is dispatched or the next retry is due
+    if (wait > 0) {
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    }
+  }
+}
+
+uint32_t NotificationDispatcher::processOnce() {
+  uint32_t wait = IDLE_WAIT_MS;
+  
+  // Each channel advances independently, a backend that is backing off
+  // never holds up the others
+  for (int i = 0; i < channelCount; i++) {
+    uint32_t channelWait = serviceChannel(channels[i], millis());
+    if (channelWait < wait) {
+      wait = channelWait;
+    }
+  }
+  
+  // Background work (e.g. chat commands) only runs on idle channels
+  for (int i = 0; i < channelCount; i++) {
+    if (!channels[i].hasPending && uxQueueMessagesWaiting(channels[i].queue) == 0) {
+      channels[i].notifier->poll();
+    }
+  }
+  
+  return wait;
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "core/infrastructure/notifier/notifier.h"
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
+#include <Arduino.h>
+
+/**
+ * @brief Notification Dispatcher - Fans out events to all notifier backends
+ * 
+ * Every registered backend owns a bounded queue and its own retry state.
+ * dispatch() only copies the event into those queues (never blocks), and a
+ * single low-priority task performs the actual deliveries, so adding a
+ * channel adds no latency to the scan path. ALERTs are acknowledged to the
+ * scanner with a receipt: on the first backend that delivers one, or once
+ * every backend has given up on it.
+ */
+class NotificationDispatcher {
+public:
+  static const int MAX_CHANNELS = 4;
+  static const UBaseType_t QUEUE_DEPTH = 8;
+  
+  // Per-channel delivery statistics
+  struct ChannelStats {
+    uint32_t delivered;
+    uint32_t retries;
+    uint32_t failed;    // dropped after exhausting the retry policy
+    uint32_t overflow;  // dropped because the queue was full
+  };
+  
+  // Outcome of an ALERT: first delivery, or every channel gave up
+  struct Receipt {
+    int8_t targetIndex;
+    bool delivered;     // at least one backend accepted it
+  };
+  
+private:
+  struct Channel {
+    Notifier* notifier;
+    QueueHandle_t queue;
+    NotificationEvent pending;
+    bool hasPending;
+    uint8_t attempts;
+    uint32_t nextAttemptAt;
+    ChannelStats stats;
+  };
+  
+  // In-flight ALERT per target (the monitor never queues a second one)
+  struct Delivery {
+    uint8_t remaining;  // channels still holding the event
+    bool delivered;
+  };
+  
+  static Channel channels[MAX_CHANNELS];
+  static int channelCount;
+  static Delivery deliveries[MAX_TARGETS];
+  static QueueHandle_t receiptQueue;
+  static portMUX_TYPE deliveryLock;
+  static TaskHandle_t task_handle;
+  static RtosAlloc::TaskBuffer task_buffer;
+  static int watchdogSlot;
+  static bool initialized;
+  
+  static const uint32_t IDLE_WAIT_MS = 1000;
+  // One delivery can take a full TLS handshake plus retries
+  static const uint32_t TASK_DEADLINE_MS = 60000;
+  
+public:
+  // Initialization
+  static bool initialize();
+  static void cleanup();
+  
+  // Backend registration (before initialize())
+  static bool registerNotifier(Notifier* notifier);
+  
+  // Non-blocking fan-out, returns true if at least one backend accepted the event
+  static bool dispatch(const NotificationEvent& event);
+  
+  // Scanner side, non-blocking: next ALERT outcome, false if none
+  static bool takeReceipt(Receipt& receipt);
+  
+  // One delivery pass over all channels (the task's loop body),
+  // returns how long until a retry is due
+  static uint32_t processOnce();
+  
+  // Status
+  static bool isInitialized() { return initialized; }
+  static int getChannelCount() { return channelCount; }
+  static bool getChannelStats(int channel, ChannelStats& stats);
+  static void printStatistics();
+  
+private:
+  static void notificationTask(void* pv);
+  static bool startTask();
+  static uint32_t serviceChannel(Channel& channel, uint32_t now);
+  static void settleDelivery(int8_t targetIndex, uint8_t channelsDone, bool delivered);
+};
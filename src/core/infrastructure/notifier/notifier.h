@@ -0,0 +1,79 @@
+#pragma once
+#include "core/domain/status/status.h"
+#include <Arduino.h>
+
+// Notification event types
+enum class NotificationType : uint8_t {
+  ALERT,       // Target crossed the failure threshold
+  RECOVERY,    // Alerted target is back online
+  FLAP_START,  // Target started flapping, alerts are held
+  FLAP_END,    // Target stopped flapping, summary of the episode
+  LATENCY_DEGRADED, // Rolling p95 above the SLO for the sustain window
+  LATENCY_RESTORED  // Rolling p95 back within the SLO
+};
+
+inline const char* getNotificationTypeName(NotificationType type) {
+  switch (type) {
+    case NotificationType::ALERT: return "alert";
+    case NotificationType::RECOVERY: return "recovery";
+    case NotificationType::FLAP_START: return "flap_start";
+    case NotificationType::FLAP_END: return "flap_end";
+    case NotificationType::LATENCY_DEGRADED: return "latency_degraded";
+    case NotificationType::LATENCY_RESTORED: return "latency_restored";
+    default: return "unknown";
+  }
+}
+
+/**
+ * @brief Backend-agnostic notification event
+ * 
+ * Fixed-size so it can be copied into FreeRTOS queues. Every backend
+ * receives the same event and renders it in its own format.
+ */
+struct NotificationEvent {
+  NotificationType type;
+  int8_t targetIndex;
+  Status status;
+  uint16_t latency;            // latency events: rolling p95
+  uint16_t thresholdMs;        // latency events: p95 SLO
+  uint32_t downtimeSeconds;    // flap end / latency restored: duration of the episode
+  uint32_t firstFailureTime;   // millis() of the first failure
+  uint32_t alertStartTime;     // millis() when the downtime alert started
+  uint32_t createdAt;          // millis() when the event was raised
+  uint16_t stateChanges;       // flap events: state changes during the episode
+  uint8_t changePercent;       // flap events: percent state change
+  uint8_t dependentCount;      // alert events: dependents now unreachable behind this target
+  char targetName[32];
+};
+
+// Per-backend delivery retry policy
+struct RetryPolicy {
+  uint8_t maxAttempts;
+  uint32_t initialBackoffMs;
+  uint32_t maxBackoffMs;
+};
+
+/**
+ * @brief Notification backend interface
+ * 
+ * Implementations are driven exclusively by the NotificationDispatcher task,
+ * so send() may block on network I/O without delaying the scan path.
+ */
+class Notifier {
+public:
+  virtual ~Notifier() {}
+  
+  // Short identifier used in logs and metrics
+  virtual const char* getName() const = 0;
+  
+  // Disabled backends are skipped by the dispatcher
+  virtual bool isActive() const = 0;
+  
+  // Deliver one event, return true on success (false schedules a retry)
+  virtual bool send(const NotificationEvent& event) = 0;
+  
+  virtual RetryPolicy getRetryPolicy() const = 0;
+  
+  // Periodic hook on the notification task (optional)
+  virtual void poll() {}
+};
@@ -1,6 +1,7 @@
 #include "core/infrastructure/ntp_service/ntp_service.h"
 #include <WiFi.h>
 #include "core/infrastructure/logger/logger.h"
+#include "core/infrastructure/dns_cache/dns_cache.h"
 
 // Static member definitions
 WiFiUDP* NTPService::ntpUDP = nullptr;
@@ -253,6 +254,11 @@ bool NTPService::isTimeSynced() {
   return initialized && timeClient && timeClient->isTimeSet();
 }
 
+unsigned long NTPService::getEpochTime() {
+  // No network access here: NTPClient extrapolates from the last sync
+  return isTimeSynced() ? timeClient->getEpochTime() : 0;
+}
+
 void NTPService::setupNTPClient() {
   // Get configuration
   String ntpServer = ConfigLoader::getNtpServer();
@@ -275,7 +281,14 @@ void NTPService::setupNTPClientWithServer(const char* server) {
   
   // Create UDP and NTP client with shorter timeout
   ntpUDP = new WiFiUDP();
-  timeClient = new NTPClient(*ntpUDP, server, timezoneOffset, 10000); // 10 second timeout
+  
+  // Resolve once through the shared cache instead of on every update
+  IPAddress serverIP;
+  if (DnsCache::resolve(server, serverIP)) {
+    timeClient = new NTPClient(*ntpUDP, serverIP, timezoneOffset, 10000); // 10 second timeout
+  } else {
+    timeClient = new NTPClient(*ntpUDP, server, timezoneOffset, 10000);
+  }
   
   Serial_printf("[NTP] Configured: Server=%s, Offset=%d seconds, Timeout=10s\n", 
                server, timezoneOffset);
@@ -25,6 +25,7 @@ public:
   static String getCurrentDateTime(); // New: returns date + time
   static String getFormattedTime();
   static bool isTimeSynced();
+  static unsigned long getEpochTime(); // Local epoch seconds, 0 if not synced
   
   // Status
   static bool isInitialized() { return initialized; }
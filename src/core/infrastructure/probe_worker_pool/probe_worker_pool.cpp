@@ -0,0 +1,255 @@
+#include "core/infrastructure/probe_worker_pool/probe_worker_pool.h"
+#include "config/config_loader/config_loader.h"
+#include "core/infrastructure/logger/logger.h"
+#include "core/infrastructure/task_watchdog/task_watchdog.h"
+
+// Static member definitions
+ProbeWorkerPool::Worker ProbeWorkerPool::workers[MAX_WORKERS];
+uint8_t ProbeWorkerPool::workerCount = 0;
+QueueHandle_t ProbeWorkerPool::results = nullptr;
+SemaphoreHandle_t ProbeWorkerPool::jobsQueued = nullptr;
+ProbeFunction ProbeWorkerPool::probeFunction = nullptr;
+void* ProbeWorkerPool::probeContext = nullptr;
+bool ProbeWorkerPool::initialized = false;
+
+bool ProbeWorkerPool::initialize(int count, ProbeFunction function, void* context) {
+  if (initialized) return true;
+
+  if (count <= 0 || !function) {
+    Serial_println("[PROBE_POOL] Disabled, probes run on the scanner task");
+    return false;
+  }
+  if (count > MAX_WORKERS) {
+    count = MAX_WORKERS;
+  }
+
+  Serial_printf("[PROBE_POOL] Starting %d probe worker(s)...\n", count);
+
+  results = RtosAlloc::createQueue(QUEUE_DEPTH, sizeof(ProbeResult));
+  jobsQueued = RtosAlloc::createCountingSemaphore(MAX_WORKERS * QUEUE_DEPTH, 0);
+  if (!results || !jobsQueued) {
+    Serial_println("[PROBE_POOL] ERROR: Failed to create result queue!");
+    if (results) vQueueDelete(results);
+    if (jobsQueued) vSemaphoreDelete(jobsQueued);
+    results = nullptr;
+    jobsQueued = nullptr;
+    return false;
+  }
+
+  probeFunction = function;
+  probeContext = context;
+
+  for (int i = 0; i < count; i++) {
+    Worker& worker = workers[i];
+    memset(&worker.stats, 0, sizeof(worker.stats));
+    worker.core = ConfigLoader::getProbeWorkerCore(i);
+    worker.stackSize = ConfigLoader::getProbeWorkerStackSize(i);
+    worker.jobs = RtosAlloc::createQueue(QUEUE_DEPTH, sizeof(int8_t));
+    worker.client = RtosAlloc::create<HttpClient>();
+    worker.task = nullptr;
+    snprintf(worker.name, sizeof(worker.name), "ProbeWorker%u", i);
+    worker.watchdogSlot = TaskWatchdog::registerTask(worker.name, WORKER_DEADLINE_MS);
+
+    if (!worker.jobs || !worker.client || !startWorker(i)) {
+      Serial_printf("[PROBE_POOL] ERROR: Failed to create worker %d!\n", i);
+      TaskWatchdog::unregisterTask(worker.watchdogSlot);
+      if (worker.jobs) vQueueDelete(worker.jobs);
+      RtosAlloc::destroy(worker.client);
+      worker.jobs = nullptr;
+      worker.client = nullptr;
+      break;
+    }
+
+    // Counted only once running, so submit() never targets a missing worker
+    workerCount = i + 1;
+    Serial_printf("[PROBE_POOL] %s on core %d (-1 = any), stack %lu\n", worker.name, worker.core,
+                 (unsigned long)worker.stackSize);
+  }
+
+  if (workerCount == 0) {
+    vQueueDelete(results);
+    vSemaphoreDelete(jobsQueued);
+    results = nullptr;
+    jobsQueued = nullptr;
+    return false;
+  }
+
+  initialized = true;
+  return true;
+}
+
+bool ProbeWorkerPool::startWorker(uint8_t id) {
+  Worker& worker = workers[id];
+
+  // Same priority as the scanner, probes are mostly blocked on the network
+  BaseType_t result = RtosAlloc::createTask(
+    workerTask,
+    worker.name,
+    worker.stackSize,
+    (void*)(intptr_t)id,
+    2,
+    &worker.task,
+    worker.core >= 0 ? worker.core : tskNO_AFFINITY,
+    worker.taskBuffer
+  );
+
+  if (result != pdPASS) {
+    worker.task = nullptr;
+    return false;
+  }
+
+  TaskWatchdog::attach(worker.watchdogSlot, worker.task);
+  return true;
+}
+
+void ProbeWorkerPool::cleanup() {
+  for (uint8_t i = 0; i < workerCount; i++) {
+    Worker& worker = workers[i];
+    TaskWatchdog::unregisterTask(worker.watchdogSlot);
+    if (worker.task) {
+      vTaskDelete(worker.task);
+      worker.task = nullptr;
+    }
+    if (worker.jobs) {
+      vQueueDelete(worker.jobs);
+      worker.jobs = nullptr;
+    }
+    RtosAlloc::destroy(worker.client);
+    worker.client = nullptr;
+  }
+
+  if (results) {
+    vQueueDelete(results);
+    results = nullptr;
+  }
+  if (jobsQueued) {
+    vSemaphoreDelete(jobsQueued);
+    jobsQueued = nullptr;
+  }
+
+  workerCount = 0;
+  initialized = false;
+}
+
+bool ProbeWorkerPool::submit(int targetIndex) {
+  if (!isEnabled()) return false;
+
+  // Home worker by index; any idle sibling may steal it from there
+  Worker& home = workers[targetIndex % workerCount];
+  int8_t job = (int8_t)targetIndex;
+  if (xQueueSend(home.jobs, &job, 0) != pdTRUE) return false;
+
+  // Wakes exactly one idle worker, whichever core it is on
+  xSemaphoreGive(jobsQueued);
+  return true;
+}
+
+bool ProbeWorkerPool::takeResult(ProbeResult& result) {
+  if (!results) return false;
+  return xQueueReceive(results, &result, 0) == pdTRUE;
+}
+
+bool ProbeWorkerPool::stealJob(uint8_t thief, int8_t& targetIndex) {
+  // Take from the sibling with the longest backlog
+  int victim = -1;
+  UBaseType_t longest = 0;
+  for (uint8_t i = 0; i < workerCount; i++) {
+    if (i == thief) continue;
+    UBaseType_t waiting = uxQueueMessagesWaiting(workers[i].jobs);
+    if (waiting > longest) {
+      longest = waiting;
+      victim = i;
+    }
+  }
+
+  // The owner may have taken it meanwhile, never wait on a sibling's queue
+  return victim >= 0 && xQueueReceive(workers[victim].jobs, &targetIndex, 0) == pdTRUE;
+}
+
+void ProbeWorkerPool::takeJob(uint8_t id, int8_t& targetIndex, bool& stolen) {
+  // The caller holds one semaphore count, so a job is queued somewhere:
+  // every count is taken by exactly one worker before it dequeues
+  while (true) {
+    if (xQueueReceive(workers[id].jobs, &targetIndex, 0) == pdTRUE) {
+      stolen = false;
+      return;
+    }
+    if (stealJob(id, targetIndex)) {
+      stolen = true;
+      return;
+    }
+    // A sibling dequeued the job seen during the scan; the one left for us is elsewhere
+    taskYIELD();
+  }
+}
+
+void ProbeWorkerPool::workerTask(void* pv) {
+  uint8_t id = (uint8_t)(intptr_t)pv;
+  Worker& worker = workers[id];
+
+  while (true) {
+    TaskWatchdog::feed(worker.watchdogSlot);
+
+    // Blocked until a job is submitted, waking only for the heartbeat
+    if (xSemaphoreTake(jobsQueued, pdMS_TO_TICKS(IDLE_WAIT_MS)) != pdTRUE) continue;
+
+    int8_t targetIndex;
+    bool stolen;
+    takeJob(id, targetIndex, stolen);
+
+    unsigned long start = millis();
+    uint16_t latency = probeFunction(probeContext, targetIndex, *worker.client);
+
+    ProbeResult result;
+    result.targetIndex = targetIndex;
+    result.workerId = id;
+    result.latency = latency;
+    result.durationMs = millis() - start;
+    result.skipped = worker.client->wasSkipped();
+
+    worker.stats.jobs++;
+    worker.stats.busyMs += result.durationMs;
+    if (stolen) worker.stats.stolen++;
+
+    // At most one job per target is in flight, so this never stays full
+    xQueueSend(results, &result, portMAX_DELAY);
+  }
+}
+
+bool ProbeWorkerPool::getWorkerStats(int worker, WorkerStats& stats) {
+  if (worker < 0 || worker >= workerCount) return false;
+  stats = workers[worker].stats;
+  return true;
+}
+
+void ProbeWorkerPool::printStatistics() {
+  Serial_println("\n=== PROBE WORKER POOL ===");
+  if (!isEnabled()) {
+    Serial_println("Disabled (probes run on the scanner task)");
+  }
+  for (uint8_t i = 0; i < workerCount; i++) {
+    const Worker& worker = workers[i];
+    const HttpClient::Metrics& http = worker.client->getMetrics();
+    Serial_printf("Worker %u (core %d): jobs=%lu stolen=%lu busy=%lums queued=%u stack free=%u\n",
+                  i, worker.core, (unsigned long)worker.stats.jobs, (unsigned long)worker.stats.stolen,
+                  (unsigned long)worker.stats.busyMs, (unsigned)uxQueueMessagesWaiting(worker.jobs),
+                  worker.task ? (unsigned)uxTaskGetStackHighWaterMark(worker.task) : 0);
+    Serial_printf("  http: requests=%lu ok=%lu ssl errors=%lu timeouts=%lu\n",
+                  (unsigned long)http.totalRequests, (unsigned long)http.successfulRequests,
+                  (unsigned long)http.sslErrors, (unsigned long)http.timeoutErrors);
+  }
+  Serial_println("=========================\n");
+}
+
+void ProbeWorkerPool::accumulateClientMetrics(HttpClient::Metrics& total) {
+  for (uint8_t i = 0; i < workerCount; i++) {
+    workers[i].client->accumulateMetrics(total);
+  }
+}
+
+void ProbeWorkerPool::resetClientMetrics() {
+  // Counters are plain words owned by the worker; a probe finishing meanwhile may survive the reset
+  for (uint8_t i = 0; i < workerCount; i++) {
+    workers[i].client->resetMetrics();
+  }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "core/infrastructure/http_client/http_client.h"
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
+#include <Arduino.h>
+
+// Runs one probe on a worker, using that worker's own HTTP client; returns the latency (0 = failed)
+typedef uint16_t (*ProbeFunction)(void* context, int targetIndex, HttpClient& client);
+
+// Finished probe, handed back to the scanner task
+struct ProbeResult {
+  int8_t targetIndex;
+  uint8_t workerId;
+  uint16_t latency;
+  uint32_t durationMs;
+  bool skipped;        // never sent (no TLS slot): not a result, the target keeps its status
+};
+
+/**
+ * @brief Probe Worker Pool - Runs probes on several tasks spread over both cores
+ *
+ * Each worker owns a small job queue and an HTTP client (a TLS session is
+ * not shareable). submit() places a job on its home worker and counts it
+ * on a shared semaphore that idle workers block on. A woken worker takes
+ * from its own queue first and otherwise steals from its siblings, so a
+ * slow handshake on one core never holds up targets the other core could
+ * serve. Results come back through one queue drained by the scanner,
+ * which keeps alert and snapshot state single-threaded.
+ */
+class ProbeWorkerPool {
+public:
+  static const uint8_t MAX_WORKERS = 4;
+  static const UBaseType_t QUEUE_DEPTH = 10;
+
+  // Per-worker statistics
+  struct WorkerStats {
+    uint32_t jobs;
+    uint32_t stolen;     // jobs taken from a sibling's queue
+    uint32_t busyMs;     // time spent inside probes
+  };
+
+private:
+  struct Worker {
+    TaskHandle_t task;
+    RtosAlloc::TaskBuffer taskBuffer;
+    QueueHandle_t jobs;
+    HttpClient* client;
+    int8_t core;         // -1 = no affinity
+    uint32_t stackSize;
+    int watchdogSlot;
+    char name[16];
+    WorkerStats stats;
+  };
+
+  static Worker workers[MAX_WORKERS];
+  static uint8_t workerCount;
+  static QueueHandle_t results;
+  static SemaphoreHandle_t jobsQueued;   // one count per job not yet taken by a worker
+  static ProbeFunction probeFunction;
+  static void* probeContext;
+  static bool initialized;
+
+  // Idle workers wake this often only to feed the watchdog
+  static const uint32_t IDLE_WAIT_MS = 5000;
+
+  // A probe retries up to ~40s (3 attempts + backoff) before giving up
+  static const uint32_t WORKER_DEADLINE_MS = 60000;
+
+public:
+  // Initialization (count 0 leaves probing on the caller's task)
+  static bool initialize(int count, ProbeFunction function, void* context);
+  static void cleanup();
+
+  // Scanner side: non-blocking submit and result collection
+  static bool submit(int targetIndex);
+  static bool takeResult(ProbeResult& result);
+
+  // Status
+  static bool isEnabled() { return initialized && workerCount > 0; }
+  static uint8_t getWorkerCount() { return workerCount; }
+  static bool getWorkerStats(int worker, WorkerStats& stats);
+  static void printStatistics();
+  
+  // HTTP metrics of the worker clients
+  static void accumulateClientMetrics(HttpClient::Metrics& total);
+  static void resetClientMetrics();
+
+private:
+  static void workerTask(void* pv);
+  static bool startWorker(uint8_t id);
+  static bool stealJob(uint8_t thief, int8_t& targetIndex);
+  static void takeJob(uint8_t id, int8_t& targetIndex, bool& stolen);
+};
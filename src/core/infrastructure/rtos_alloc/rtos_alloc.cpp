@@ -0,0 +1,141 @@
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
+#include "core/infrastructure/stack_tuner/stack_tuner.h"
+#include "core/infrastructure/logger/logger.h"
+
+// Static member definitions
+size_t RtosAlloc::arenaUsed = 0;
+size_t RtosAlloc::staticBytes = 0;
+uint16_t RtosAlloc::heapFallbacks = 0;
+uint32_t RtosAlloc::bootFreeHeap = 0;
+
+#if STATIC_ALLOCATION
+// Internal RAM (.bss): task stacks must not live in PSRAM
+alignas(8) static uint8_t arena[STATIC_ARENA_SIZE];
+#endif
+
+void* RtosAlloc::allocate(size_t size, size_t align) {
+#if STATIC_ALLOCATION
+  // Bump allocation only (never freed), called while the tasks are created at boot
+  size_t start = (arenaUsed + align - 1) & ~(align - 1);
+  if (start + size > STATIC_ARENA_SIZE) {
+    Serial_printf("[RTOS_ALLOC] WARNING: Arena full, %u bytes taken from the heap\n", (unsigned)size);
+    return nullptr;
+  }
+  arenaUsed = start + size;
+  staticBytes += size;
+  return arena + start;
+#else
+  return nullptr;
+#endif
+}
+
+bool RtosAlloc::fits(size_t firstSize, size_t firstAlign, size_t secondSize, size_t secondAlign) {
+  // Objects made of two blocks are carved whole or not at all, a lone first block would be wasted
+  size_t first = (arenaUsed + firstAlign - 1) & ~(firstAlign - 1);
+  size_t second = (first + firstSize + secondAlign - 1) & ~(secondAlign - 1);
+  if (second + secondSize <= STATIC_ARENA_SIZE) return true;
+  Serial_printf("[RTOS_ALLOC] WARNING: Arena full, %u bytes taken from the heap\n",
+                (unsigned)(firstSize + secondSize));
+  return false;
+}
+
+bool RtosAlloc::inArena(const void* pointer) {
+#if STATIC_ALLOCATION
+  const uint8_t* p = static_cast<const uint8_t*>(pointer);
+  return p >= arena && p < arena + STATIC_ARENA_SIZE;
+#else
+  return false;
+#endif
+}
+
+BaseType_t RtosAlloc::createTask(TaskFunction_t function, const char* name, uint32_t stackSize, void* parameter,
+                                 UBaseType_t priority, TaskHandle_t* handle, BaseType_t core, TaskBuffer& buffer) {
+  // Tuned on the first start, a task re-created by startTasks() keeps the same stack size
+  if (buffer.stackSize == 0) {
+    buffer.stackSize = StackTuner::stackSizeFor(name, stackSize);
+  }
+  stackSize = buffer.stackSize;
+
+#if STATIC_ALLOCATION
+  // New TCB and stack on every start: a task deleted while running on the
+  // other core keeps using its old ones until it is switched out
+  if (fits(sizeof(StaticTask_t), alignof(StaticTask_t), stackSize, 16)) {
+    StaticTask_t* tcb = static_cast<StaticTask_t*>(allocate(sizeof(StaticTask_t), alignof(StaticTask_t)));
+    StackType_t* stack = static_cast<StackType_t*>(allocate(stackSize, 16));
+    TaskHandle_t task = xTaskCreateStaticPinnedToCore(function, name, stackSize, parameter, priority, stack, tcb, core);
+    if (handle) *handle = task;
+    return task ? pdPASS : pdFAIL;
+  }
+  heapFallbacks++;
+#endif
+  return xTaskCreatePinnedToCore(function, name, stackSize, parameter, priority, handle, core);
+}
+
+QueueHandle_t RtosAlloc::createQueue(UBaseType_t length, UBaseType_t itemSize) {
+#if STATIC_ALLOCATION
+  if (fits(sizeof(StaticQueue_t), alignof(StaticQueue_t), length * itemSize, 4)) {
+    StaticQueue_t* control = static_cast<StaticQueue_t*>(allocate(sizeof(StaticQueue_t), alignof(StaticQueue_t)));
+    uint8_t* storage = static_cast<uint8_t*>(allocate(length * itemSize, 4));
+    return xQueueCreateStatic(length, itemSize, storage, control);
+  }
+  heapFallbacks++;
+#endif
+  return xQueueCreate(length, itemSize);
+}
+
+SemaphoreHandle_t RtosAlloc::createMutex() {
+#if STATIC_ALLOCATION
+  StaticSemaphore_t* control =
+      static_cast<StaticSemaphore_t*>(allocate(sizeof(StaticSemaphore_t), alignof(StaticSemaphore_t)));
+  if (control) {
+    return xSemaphoreCreateMutexStatic(control);
+  }
+  heapFallbacks++;
+#endif
+  return xSemaphoreCreateMutex();
+}
+
+SemaphoreHandle_t RtosAlloc::createBinarySemaphore() {
+#if STATIC_ALLOCATION
+  StaticSemaphore_t* control =
+      static_cast<StaticSemaphore_t*>(allocate(sizeof(StaticSemaphore_t), alignof(StaticSemaphore_t)));
+  if (control) {
+    return xSemaphoreCreateBinaryStatic(control);
+  }
+  heapFallbacks++;
+#endif
+  return xSemaphoreCreateBinary();
+}
+
+SemaphoreHandle_t RtosAlloc::createCountingSemaphore(UBaseType_t maxCount, UBaseType_t initialCount) {
+#if STATIC_ALLOCATION
+  StaticSemaphore_t* control =
+      static_cast<StaticSemaphore_t*>(allocate(sizeof(StaticSemaphore_t), alignof(StaticSemaphore_t)));
+  if (control) {
+    return xSemaphoreCreateCountingStatic(maxCount, initialCount, control);
+  }
+  heapFallbacks++;
+#endif
+  return xSemaphoreCreateCounting(maxCount, initialCount);
+}
+
+void RtosAlloc::markBoot() {
+  bootFreeHeap = ESP.getFreeHeap();
+}
+
+void RtosAlloc::printStatistics() {
+  uint32_t freeHeap = ESP.getFreeHeap();
+  Serial_println("\n=== BOOT ALLOCATION ===");
+  Serial_printf("Mode: %s\n", isStatic() ? "static" : "heap");
+  Serial_printf("Heap used since boot: %lu bytes (free %lu, largest block %lu)\n",
+                (unsigned long)(bootFreeHeap - freeHeap), (unsigned long)freeHeap,
+                (unsigned long)ESP.getMaxAllocHeap());
+  if (isStatic()) {
+    Serial_printf("Heap saved: %lu bytes in static storage (arena %lu/%lu)\n", (unsigned long)staticBytes,
+                  (unsigned long)arenaUsed, (unsigned long)STATIC_ARENA_SIZE);
+    if (heapFallbacks > 0) {
+      Serial_printf("WARNING: %u object(s) fell back to the heap, raise STATIC_ARENA_SIZE\n", heapFallbacks);
+    }
+  }
+  Serial_println("=======================\n");
+}
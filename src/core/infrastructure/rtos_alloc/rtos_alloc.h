@@ -0,0 +1,100 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <Arduino.h>
+#include <new>
+#include <utility>
+
+// Build option: -D STATIC_ALLOCATION=1 (see the esp32dev-static environment)
+#ifndef STATIC_ALLOCATION
+#define STATIC_ALLOCATION 0
+#endif
+
+// Arena backing every task stack, queue and worker object in static mode
+#ifndef STATIC_ARENA_SIZE
+#define STATIC_ARENA_SIZE (56 * 1024)
+#endif
+
+/**
+ * @brief RTOS Alloc - One place to create tasks, queues, mutexes and services
+ *
+ * In the default build everything comes from the heap, as before. With
+ * STATIC_ALLOCATION the same calls use the *Static FreeRTOS APIs: stacks,
+ * TCBs and queue storage are carved once from a fixed arena in .bss and
+ * services are built in per-type static storage, so boot-time heap use no
+ * longer depends on creation order and the heap is unfragmented when the
+ * first scan starts. Tasks are created once at boot; a task re-created
+ * through TaskManager::stopTasks()/startTasks() takes a new TCB and stack
+ * from the arena and the old ones are never freed. If the arena runs out
+ * the object falls back to the heap with a warning instead of failing boot.
+ */
+class RtosAlloc {
+public:
+  // Owned by whoever creates the task; a re-created task keeps its tuned stack size
+  struct TaskBuffer {
+    uint32_t stackSize;
+  };
+
+private:
+  static size_t arenaUsed;
+  static size_t staticBytes;   // everything placed outside the heap
+  static uint16_t heapFallbacks;
+  static uint32_t bootFreeHeap;
+
+public:
+  static bool isStatic() { return STATIC_ALLOCATION != 0; }
+
+  // FreeRTOS objects
+  static BaseType_t createTask(TaskFunction_t function, const char* name, uint32_t stackSize, void* parameter,
+                               UBaseType_t priority, TaskHandle_t* handle, BaseType_t core, TaskBuffer& buffer);
+  static QueueHandle_t createQueue(UBaseType_t length, UBaseType_t itemSize);
+  static SemaphoreHandle_t createMutex();
+  static SemaphoreHandle_t createBinarySemaphore();
+  static SemaphoreHandle_t createCountingSemaphore(UBaseType_t maxCount, UBaseType_t initialCount);
+
+  // Per-instance objects (e.g. one HTTP client per worker), arena-backed in static mode
+  template <typename T, typename... Args>
+  static T* create(Args&&... args) {
+#if STATIC_ALLOCATION
+    void* memory = allocate(sizeof(T), alignof(T));
+    if (memory) return new (memory) T(std::forward<Args>(args)...);
+    heapFallbacks++;
+#endif
+    return new T(std::forward<Args>(args)...);
+  }
+
+  // Releases an object from create() (destroyed in place if arena-backed)
+  template <typename T>
+  static void destroy(T* object) {
+#if STATIC_ALLOCATION
+    if (object && inArena(object)) {
+      object->~T();
+      return;
+    }
+#endif
+    delete object;
+  }
+
+  // Application singletons, one static slot per type
+  template <typename T, typename... Args>
+  static T* service(Args&&... args) {
+#if STATIC_ALLOCATION
+    alignas(T) static uint8_t storage[sizeof(T)];
+    staticBytes += sizeof(T);
+    return new (storage) T(std::forward<Args>(args)...);
+#else
+    return new T(std::forward<Args>(args)...);
+#endif
+  }
+
+  // Heap accounting, markBoot() first thing in setup()
+  static void markBoot();
+  static void printStatistics();
+
+private:
+  static void* allocate(size_t size, size_t align);
+  static bool fits(size_t firstSize, size_t firstAlign, size_t secondSize, size_t secondAlign);
+  static bool inArena(const void* pointer);
+};
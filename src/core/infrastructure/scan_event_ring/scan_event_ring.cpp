@@ -0,0 +1,74 @@
+#include "core/infrastructure/scan_event_ring/scan_event_ring.h"
+
+ScanEventRing::ScanEventRing() : head(0), tail(0), pendingTargets(0) {
+  for (int i = 0; i < MAX_TARGETS; i++) {
+    latest[i].store(0, std::memory_order_relaxed);
+  }
+  memset(&stats, 0, sizeof(stats));
+}
+
+bool ScanEventRing::push(const ScanEvent& event) {
+  if (event.type != EV_TARGET_UPDATE) {
+    return enqueue(event);
+  }
+
+  if (event.index < 0 || event.index >= MAX_TARGETS) return false;
+
+  // Publish the value first, then the marker that points at it
+  latest[event.index].store(((uint32_t)event.status << 16) | event.latency_ms, std::memory_order_release);
+
+  uint32_t bit = 1UL << event.index;
+  if (pendingTargets.fetch_or(bit, std::memory_order_acq_rel) & bit) {
+    // Consumer hasn't reached the earlier marker yet, it will read this value
+    stats.merged++;
+    return true;
+  }
+
+  if (!enqueue(event)) {
+    // Unreachable with CAPACITY > MAX_TARGETS, but never leave a stale bit
+    pendingTargets.fetch_and(~bit, std::memory_order_acq_rel);
+    return false;
+  }
+  return true;
+}
+
+bool ScanEventRing::enqueue(const ScanEvent& event) {
+  uint16_t h = head.load(std::memory_order_relaxed);
+  uint16_t used = (uint16_t)(h - tail.load(std::memory_order_acquire));
+  if (used >= CAPACITY) {
+    stats.dropped++;
+    return false;
+  }
+
+  slots[h & (CAPACITY - 1)] = event;
+  head.store((uint16_t)(h + 1), std::memory_order_release);
+
+  stats.pushed++;
+  if (used + 1 > stats.highWater) {
+    stats.highWater = used + 1;
+  }
+  return true;
+}
+
+bool ScanEventRing::pop(ScanEvent& event) {
+  uint16_t t = tail.load(std::memory_order_relaxed);
+  if (t == head.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  event = slots[t & (CAPACITY - 1)];
+  tail.store((uint16_t)(t + 1), std::memory_order_release);
+
+  if (event.type == EV_TARGET_UPDATE) {
+    // Clear the marker before reading, so a newer value queues a new marker
+    pendingTargets.fetch_and(~(1UL << event.index), std::memory_order_acq_rel);
+    uint32_t value = latest[event.index].load(std::memory_order_acquire);
+    event.status = (Status)(value >> 16);
+    event.latency_ms = (uint16_t)value;
+  }
+  return true;
+}
+
+uint8_t ScanEventRing::size() const {
+  return (uint8_t)(uint16_t)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+}
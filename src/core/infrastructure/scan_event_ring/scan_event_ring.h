@@ -0,0 +1,50 @@
+#pragma once
+#include "core/domain/status/status.h"
+#include <Arduino.h>
+#include <atomic>
+
+/**
+ * @brief Scan Event Ring - Lock-free scanner to display channel
+ *
+ * Single producer (scanner task), single consumer (display task). Neither
+ * side ever blocks or takes a lock. Target updates are merged: the ring only
+ * carries "target N changed" markers, the latest status/latency lives in a
+ * per-target atomic word, and a target already marked pending is not queued
+ * again. The display therefore sees every target's latest state, never a
+ * backlog of stale ones, and the ring cannot fill with target updates.
+ */
+class ScanEventRing {
+public:
+  static const uint8_t CAPACITY = 32;     // power of two
+
+  struct Stats {
+    uint32_t pushed;      // events queued
+    uint32_t merged;      // target updates folded into a pending one
+    uint32_t dropped;     // ring full (scan start/complete only)
+    uint8_t highWater;    // most events ever waiting
+  };
+
+private:
+  ScanEvent slots[CAPACITY];
+  std::atomic<uint16_t> head;                 // written by the producer only
+  std::atomic<uint16_t> tail;                 // written by the consumer only
+  std::atomic<uint32_t> pendingTargets;       // targets with a marker in the ring
+  std::atomic<uint32_t> latest[MAX_TARGETS];  // status << 16 | latency
+  Stats stats;                                // producer-side counters
+
+public:
+  ScanEventRing();
+
+  // Producer side (scanner task only)
+  bool push(const ScanEvent& event);
+
+  // Consumer side (display task only)
+  bool pop(ScanEvent& event);
+
+  // Status
+  uint8_t size() const;
+  const Stats& getStats() const { return stats; }
+
+private:
+  bool enqueue(const ScanEvent& event);
+};
@@ -0,0 +1,214 @@
+#include "core/infrastructure/stack_tuner/stack_tuner.h"
+#include "core/infrastructure/cpu_monitor/cpu_monitor.h"
+#include "core/infrastructure/logger/logger.h"
+#include <SPIFFS.h>
+
+// Static member definitions
+StackTuner::Entry StackTuner::entries[MAX_TASKS];
+uint8_t StackTuner::entryCount = 0;
+portMUX_TYPE StackTuner::lock = portMUX_INITIALIZER_UNLOCKED;
+StackTuner::Mode StackTuner::mode = StackTuner::OFF;
+uint8_t StackTuner::marginPercent = 25;
+uint32_t StackTuner::configKey = 0;
+bool StackTuner::dirty = false;
+uint32_t StackTuner::lastSaveAt = 0;
+bool StackTuner::initialized = false;
+const char* StackTuner::PROFILE_PATH = "/stack_profile.txt";
+
+bool StackTuner::initialize(Mode tuningMode, uint8_t margin, uint32_t key) {
+  if (initialized) return true;
+
+  mode = tuningMode;
+  marginPercent = margin;
+  configKey = key;
+  if (mode == OFF) {
+    Serial_println("[STACK] Stack tuning disabled");
+    return true;
+  }
+
+  loadProfile();
+  lastSaveAt = millis();
+  initialized = true;
+
+  Serial_printf("[STACK] Mode %s, margin %u%%, %u task(s) in the saved profile\n", mode == APPLY ? "apply" : "record",
+                marginPercent, entryCount);
+#if !configUSE_TRACE_FACILITY
+  Serial_println("[STACK] WARNING: No task list in this FreeRTOS build, nothing will be recorded");
+#endif
+  return true;
+}
+
+StackTuner::Mode StackTuner::parseMode(const String& value) {
+  if (value.equalsIgnoreCase("off")) return OFF;
+  if (value.equalsIgnoreCase("apply")) return APPLY;
+  return RECORD;
+}
+
+int StackTuner::findEntry(const char* name) {
+  for (int i = 0; i < entryCount; i++) {
+    if (strncmp(entries[i].name, name, sizeof(entries[i].name)) == 0) return i;
+  }
+  return -1;
+}
+
+int StackTuner::addEntry(const char* name) {
+  if (entryCount >= MAX_TASKS) return -1;
+  Entry& entry = entries[entryCount];
+  memset(&entry, 0, sizeof(entry));
+  strncpy(entry.name, name, sizeof(entry.name) - 1);
+  return entryCount++;
+}
+
+uint32_t StackTuner::suggestedSize(const Entry& entry) {
+  if (entry.peak == 0) return 0;
+  uint32_t margin = entry.peak * marginPercent / 100;
+  if (margin < MIN_MARGIN) margin = MIN_MARGIN;
+  uint32_t size = (entry.peak + margin + 255) & ~255u;
+  return size < MIN_STACK ? MIN_STACK : size;
+}
+
+uint32_t StackTuner::stackSizeFor(const char* name, uint32_t configured) {
+  if (!initialized) return configured;
+
+  portENTER_CRITICAL(&lock);
+  int index = findEntry(name);
+  if (index < 0) index = addEntry(name);
+  uint32_t size = configured;
+  uint32_t peak = 0;
+  uint32_t stalePeak = 0;
+  if (index >= 0) {
+    Entry& entry = entries[index];
+    entry.configured = configured;
+    // Recorded under another stack size: the old peak says nothing about this one
+    if (entry.peak > 0 && entry.recordedFor != configured) {
+      stalePeak = entry.peak;
+      entry.peak = 0;
+      dirty = true;
+    }
+    entry.recordedFor = configured;
+    uint32_t suggested = suggestedSize(entry);
+    if (mode == APPLY && suggested > 0) size = suggested;
+    entry.allocated = size;
+    peak = entry.peak;
+  }
+  portEXIT_CRITICAL(&lock);
+
+  if (stalePeak > 0) {
+    Serial_printf("[STACK] %s: configured size changed to %lu, recorded peak %lu discarded\n", name,
+                  (unsigned long)configured, (unsigned long)stalePeak);
+  }
+  if (size != configured) {
+    Serial_printf("[STACK] %s: %lu -> %lu bytes (peak %lu)\n", name, (unsigned long)configured,
+                  (unsigned long)size, (unsigned long)peak);
+  }
+  return size;
+}
+
+void StackTuner::update() {
+  if (!initialized) return;
+
+  // Same sample CpuMonitor already took, high-water marks only ever shrink
+  static CpuMonitor::TaskLoad loads[CpuMonitor::MAX_TASKS];
+  uint8_t count = CpuMonitor::getTaskLoads(loads, CpuMonitor::MAX_TASKS);
+
+  portENTER_CRITICAL(&lock);
+  for (uint8_t i = 0; i < count; i++) {
+    int index = findEntry(loads[i].name);
+    if (index < 0) continue;
+    Entry& entry = entries[index];
+    if (entry.allocated == 0 || loads[i].stackFree > entry.allocated) continue;
+
+    if (entry.minFree == 0 || loads[i].stackFree < entry.minFree) {
+      entry.minFree = loads[i].stackFree;
+    }
+    uint32_t used = entry.allocated - loads[i].stackFree;
+    if (used > entry.peak) {
+      entry.peak = used;
+      dirty = true;
+    }
+  }
+  bool save = dirty && millis() - lastSaveAt >= SAVE_INTERVAL_MS;
+  portEXIT_CRITICAL(&lock);
+
+  if (save) {
+    saveProfile();
+  }
+}
+
+void StackTuner::loadProfile() {
+  File file = SPIFFS.open(PROFILE_PATH, "r");
+  if (!file) return;
+
+  // "config=key", then one "TaskName=peakBytes/configuredBytes" per line
+  String header = file.readStringUntil('\n');
+  header.trim();
+  if (header != "config=" + String((unsigned long)configKey)) {
+    file.close();
+    Serial_println("[STACK] Profile was recorded under another configuration, starting over");
+    return;
+  }
+
+  while (file.available()) {
+    String line = file.readStringUntil('\n');
+    line.trim();
+    int separator = line.indexOf('=');
+    int slash = line.indexOf('/', separator + 1);
+    if (separator <= 0 || slash < 0) continue;
+
+    String name = line.substring(0, separator);
+    int index = addEntry(name.c_str());
+    if (index < 0) break;
+    entries[index].peak = line.substring(separator + 1, slash).toInt();
+    entries[index].recordedFor = line.substring(slash + 1).toInt();
+  }
+  file.close();
+}
+
+void StackTuner::saveProfile() {
+  Entry snapshot[MAX_TASKS];
+  portENTER_CRITICAL(&lock);
+  uint8_t count = entryCount;
+  memcpy(snapshot, entries, sizeof(Entry) * count);
+  dirty = false;
+  portEXIT_CRITICAL(&lock);
+  lastSaveAt = millis();
+
+  File file = SPIFFS.open(PROFILE_PATH, "w");
+  if (!file) {
+    Serial_println("[STACK] ERROR: Failed to save stack profile!");
+    return;
+  }
+  file.printf("config=%lu\n", (unsigned long)configKey);
+  for (uint8_t i = 0; i < count; i++) {
+    if (snapshot[i].peak == 0) continue;
+    file.printf("%s=%lu/%lu\n", snapshot[i].name, (unsigned long)snapshot[i].peak,
+                (unsigned long)snapshot[i].recordedFor);
+  }
+  file.close();
+  Serial_printf("[STACK] Profile saved (%u tasks)\n", count);
+}
+
+void StackTuner::printStatistics() {
+  if (!initialized) return;
+
+  Entry snapshot[MAX_TASKS];
+  portENTER_CRITICAL(&lock);
+  uint8_t count = entryCount;
+  memcpy(snapshot, entries, sizeof(Entry) * count);
+  portEXIT_CRITICAL(&lock);
+
+  Serial_println("\n=== STACK TUNING ===");
+  int32_t reclaimable = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    const Entry& entry = snapshot[i];
+    if (entry.allocated == 0) continue;   // profile entry for a task not running
+    uint32_t suggested = suggestedSize(entry);
+    Serial_printf("%-16s code %5lu  alloc %5lu  peak %5lu  min free %5lu  suggested %5lu\n", entry.name,
+                  (unsigned long)entry.configured, (unsigned long)entry.allocated, (unsigned long)entry.peak,
+                  (unsigned long)entry.minFree, (unsigned long)suggested);
+    if (suggested > 0) reclaimable += (int32_t)entry.allocated - (int32_t)suggested;
+  }
+  Serial_printf("Mode: %s | %s: %ld bytes\n", mode == APPLY ? "apply" : "record",
+                mode == APPLY ? "Further change" : "Reclaimable with STACK_TUNING=apply", (long)reclaimable);
+  Serial_println("====================\n");
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <Arduino.h>
+
+/**
+ * @brief Stack Tuner - Stack sizes from observed high-water marks
+ *
+ * Every task created through RtosAlloc reports its configured stack here.
+ * update() reads each task's minimum free stack (from CpuMonitor's sample)
+ * and keeps the peak use per task name across boots, through a small
+ * profile on SPIFFS. In apply mode a task with a
+ * recorded peak gets peak + margin instead of its hard-coded size, so a
+ * soak run in record mode followed by apply returns the unused stack to
+ * the heap. Peaks are only trusted for the configuration they were
+ * recorded under: the profile carries a key for the settings that shape
+ * the load (the worker count) and each task's configured size, and a
+ * mismatch discards the stale peaks instead of applying them.
+ */
+class StackTuner {
+public:
+  enum Mode { OFF, RECORD, APPLY };
+
+  static const uint8_t MAX_TASKS = 16;
+  static const uint32_t MIN_STACK = 2048;      // never tune below this
+  static const uint32_t MIN_MARGIN = 512;
+
+private:
+  struct Entry {
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t configured;   // size in the code
+    uint32_t allocated;    // size the running instance got
+    uint32_t peak;         // most stack ever used, 0 = never seen
+    uint32_t recordedFor;  // configured size the peak was measured with
+    uint32_t minFree;      // this boot
+  };
+
+  static Entry entries[MAX_TASKS];
+  static uint8_t entryCount;
+  static portMUX_TYPE lock;
+  static Mode mode;
+  static uint8_t marginPercent;
+  static uint32_t configKey;
+  static bool dirty;
+  static uint32_t lastSaveAt;
+  static bool initialized;
+
+  static const char* PROFILE_PATH;
+  static const uint32_t SAVE_INTERVAL_MS = 10 * 60 * 1000;   // spare the flash
+
+public:
+  // Loads the saved profile if it was recorded under the same configKey (SPIFFS must be mounted)
+  static bool initialize(Mode tuningMode, uint8_t margin, uint32_t key);
+  static Mode parseMode(const String& value);
+
+  // Called by RtosAlloc before creating a task, returns the size to use
+  static uint32_t stackSizeFor(const char* name, uint32_t configured);
+
+  // Records the current minimum free stacks (call after CpuMonitor::update())
+  static void update();
+
+  // Status
+  static Mode getMode() { return mode; }
+  static void printStatistics();
+
+private:
+  static int findEntry(const char* name);
+  static int addEntry(const char* name);
+  static uint32_t suggestedSize(const Entry& entry);
+  static void loadProfile();
+  static void saveProfile();
+};
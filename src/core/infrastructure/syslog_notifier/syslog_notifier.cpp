@@ -0,0 +1,99 @@
+#include "core/infrastructure/syslog_notifier/syslog_notifier.h"
+#include "core/infrastructure/logger/logger.h"
+#include "core/infrastructure/dns_cache/dns_cache.h"
+#include <WiFi.h>
+
+SyslogNotifier::SyslogNotifier() : port(514), enabled(false) {
+}
+
+bool SyslogNotifier::initialize(const String& host, uint16_t port, bool enabled) {
+  if (!enabled) {
+    this->enabled = false;
+    return true;
+  }
+  
+  if (host.length() == 0 || port == 0) {
+    Serial_println("[SYSLOG] ERROR: Syslog host or port not provided");
+    this->enabled = false;
+    return false;
+  }
+  
+  this->host = host;
+  this->port = port;
+  this->enabled = true;
+  
+  Serial_printf("[SYSLOG] Service initialized: %s:%u\n", host.c_str(), port);
+  return true;
+}
+
+size_t SyslogNotifier::formatMessage(const NotificationEvent& event) {
+  uint8_t severity = SEVERITY_NOTICE;
+  if (event.type == NotificationType::ALERT) {
+    severity = SEVERITY_ERROR;
+  } else if (event.type == NotificationType::FLAP_START || event.type == NotificationType::LATENCY_DEGRADED) {
+    severity = SEVERITY_WARNING;
+  }
+  uint8_t priority = FACILITY_LOCAL0 * 8 + severity;
+  
+  // MSGID is the upper-cased event type (ALERT, RECOVERY, FLAP_START, ...)
+  char msgId[24];
+  const char* typeName = getNotificationTypeName(event.type);
+  size_t i = 0;
+  for (; typeName[i] && i < sizeof(msgId) - 1; i++) {
+    msgId[i] = toupper((unsigned char)typeName[i]);
+  }
+  msgId[i] = '\0';
+  
+  // <PRI>1 TIMESTAMP HOSTNAME APP-NAME PROCID MSGID SD MSG
+  // The device clock may not be NTP-synced, so the timestamp is left nil
+  // and the collector stamps the message on arrival
+  int written = snprintf(messageBuffer, MESSAGE_BUFFER_SIZE,
+                         "<%u>1 - nebula-monitor nebula - %s - target=\"%s\" status=%s latency_ms=%u downtime_s=%lu",
+                         (unsigned)priority, msgId, event.targetName, getStatusName(event.status),
+                         (unsigned)event.latency, (unsigned long)event.downtimeSeconds);
+  
+  if (written > 0 && (event.type == NotificationType::FLAP_START || event.type == NotificationType::FLAP_END) &&
+      (size_t)written < MESSAGE_BUFFER_SIZE) {
+    written += snprintf(messageBuffer + written, MESSAGE_BUFFER_SIZE - written, " state_changes=%u change_pct=%u",
+                        (unsigned)event.stateChanges, (unsigned)event.changePercent);
+  }
+  
+  if (written > 0 && (event.type == NotificationType::LATENCY_DEGRADED || event.type == NotificationType::LATENCY_RESTORED) &&
+      (size_t)written < MESSAGE_BUFFER_SIZE) {
+    written += snprintf(messageBuffer + written, MESSAGE_BUFFER_SIZE - written, " slo_ms=%u", (unsigned)event.thresholdMs);
+  }
+  
+  if (written > 0 && event.dependentCount > 0 && (size_t)written < MESSAGE_BUFFER_SIZE) {
+    written += snprintf(messageBuffer + written, MESSAGE_BUFFER_SIZE - written, " dependents=%u", (unsigned)event.dependentCount);
+  }
+  
+  if (written < 0) return 0;
+  return (size_t)written < MESSAGE_BUFFER_SIZE ? (size_t)written : MESSAGE_BUFFER_SIZE - 1;
+}
+
+bool SyslogNotifier::send(const NotificationEvent& event) {
+  if (!enabled || WiFi.status() != WL_CONNECTED) {
+    return false;
+  }
+  
+  size_t length = formatMessage(event);
+  
+  IPAddress address;
+  if (!DnsCache::resolve(host.c_str(), address)) {
+    Serial_printf("[SYSLOG] ERROR: Cannot resolve %s\n", host.c_str());
+    return false;
+  }
+  
+  if (!udp.beginPacket(address, port)) {
+    Serial_println("[SYSLOG] ERROR: Failed to open UDP packet");
+    return false;
+  }
+  
+  udp.write((const uint8_t*)messageBuffer, length);
+  if (!udp.endPacket()) {
+    Serial_println("[SYSLOG] ERROR: Failed to send UDP packet");
+    return false;
+  }
+  
+  return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "core/infrastructure/notifier/notifier.h"
+#include <WiFiUdp.h>
+#include <Arduino.h>
+
+/**
+ * @brief Syslog Notifier - Sends alert events as RFC 5424 messages over UDP
+ * 
+ * UDP delivery is fire-and-forget, only local failures (no WiFi, no socket)
+ * are worth a single quick retry.
+ */
+class SyslogNotifier : public Notifier {
+private:
+  String host;
+  uint16_t port;
+  bool enabled;
+  WiFiUDP udp;
+  
+  static const size_t MESSAGE_BUFFER_SIZE = 256;
+  char messageBuffer[MESSAGE_BUFFER_SIZE];
+  
+  // Facility local0, RFC 5424 section 6.2.1
+  static const uint8_t FACILITY_LOCAL0 = 16;
+  static const uint8_t SEVERITY_ERROR = 3;
+  static const uint8_t SEVERITY_WARNING = 4;
+  static const uint8_t SEVERITY_NOTICE = 5;
+  
+public:
+  SyslogNotifier();
+  
+  // Initialization
+  bool initialize(const String& host, uint16_t port = 514, bool enabled = true);
+  
+  // Notifier interface
+  const char* getName() const override { return "syslog"; }
+  bool isActive() const override { return enabled; }
+  bool send(const NotificationEvent& event) override;
+  RetryPolicy getRetryPolicy() const override { return {2, 1000, 1000}; }
+  
+private:
+  size_t formatMessage(const NotificationEvent& event);
+};
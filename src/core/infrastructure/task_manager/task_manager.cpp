@@ -1,14 +1,21 @@
 #include "core/infrastructure/task_manager/task_manager.h"
 #include "core/domain/network_monitor/network_monitor.h"
 #include "ui/display_manager/display_manager.h"
+#include "ui/touch_handler/touch_handler.h"
 #include "core/infrastructure/memory_manager/memory_manager.h"
+#include "core/infrastructure/task_watchdog/task_watchdog.h"
+#include "core/infrastructure/async_probe/async_probe.h"
 #include <Arduino.h>
 #include "core/infrastructure/logger/logger.h"
 
 // Static member definitions
 TaskHandle_t TaskManager::display_task_handle = nullptr;
 TaskHandle_t TaskManager::scanner_task_handle = nullptr;
-QueueHandle_t TaskManager::event_queue = nullptr;
+RtosAlloc::TaskBuffer TaskManager::display_task_buffer = {};
+RtosAlloc::TaskBuffer TaskManager::scanner_task_buffer = {};
+int TaskManager::display_watchdog_slot = -1;
+int TaskManager::scanner_watchdog_slot = -1;
+ScanEventRing TaskManager::event_ring;
 NetworkMonitor* TaskManager::networkMonitor = nullptr;
 DisplayManager* TaskManager::displayManager = nullptr;
 bool TaskManager::initialized = false;
@@ -18,9 +25,6 @@ bool TaskManager::initialize() {
   
   Serial_println("[TASK_MANAGER] Initializing task manager...");
   
-  // Create event queue
-  createEventQueue();
-  
   // Create tasks
   createTasks();
   
@@ -36,12 +40,6 @@ void TaskManager::cleanup() {
   // Stop tasks
   stopTasks();
   
-  // Delete event queue
-  if (event_queue) {
-    vQueueDelete(event_queue);
-    event_queue = nullptr;
-  }
-  
   initialized = false;
   Serial_println("[TASK_MANAGER] Task manager cleaned up");
 }
@@ -65,6 +63,10 @@ bool TaskManager::startTasks() {
 }
 
 void TaskManager::stopTasks() {
+  // Stopped on purpose, not hung
+  TaskWatchdog::attach(display_watchdog_slot, nullptr);
+  TaskWatchdog::attach(scanner_watchdog_slot, nullptr);
+  
   if (display_task_handle) {
     vTaskDelete(display_task_handle);
     display_task_handle = nullptr;
@@ -84,70 +86,106 @@ void TaskManager::setDependencies(NetworkMonitor* nm, DisplayManager* dm) {
 }
 
 bool TaskManager::sendEvent(const ScanEvent& event) {
-  if (!event_queue) return false;
+  // Never blocks the scanner, rendering happens on the display task
+  if (!event_ring.push(event)) return false;
   
-  return xQueueSend(event_queue, &event, 0) == pdTRUE;
+  if (display_task_handle) {
+    xTaskNotifyGive(display_task_handle);
+  }
+  return true;
 }
 
-bool TaskManager::receiveEvent(ScanEvent& event, uint32_t timeout_ms) {
-  if (!event_queue) return false;
-  
-  TickType_t timeout = timeout_ms > 0 ? pdMS_TO_TICKS(timeout_ms) : 0;
-  return xQueueReceive(event_queue, &event, timeout) == pdTRUE;
+bool TaskManager::receiveEvent(ScanEvent& event) {
+  return event_ring.pop(event);
 }
 
-void TaskManager::createEventQueue() {
-  event_queue = xQueueCreate(20, sizeof(ScanEvent));
-  if (!event_queue) {
-    Serial_println("[TASK_MANAGER] ERROR: Failed to create event queue!");
-  } else {
-    Serial_println("[TASK_MANAGER] Event queue created successfully");
-  }
+void TaskManager::printEventStatistics() {
+  const ScanEventRing::Stats& stats = event_ring.getStats();
+  Serial_printf("[TASK_MANAGER] Display events: pushed=%lu merged=%lu dropped=%lu waiting=%u peak=%u\n",
+                (unsigned long)stats.pushed, (unsigned long)stats.merged, (unsigned long)stats.dropped,
+                event_ring.size(), stats.highWater);
+  Serial_printf("[TASK_MANAGER] Status snapshot: #%lu published, %lu publish(es) deferred by readers\n",
+                (unsigned long)StatusSnapshotStore::getSequence(),
+                (unsigned long)StatusSnapshotStore::getDeferredCount());
 }
 
 void TaskManager::createTasks() {
+  if (display_watchdog_slot < 0) {
+    display_watchdog_slot = TaskWatchdog::registerTask("DisplayTask", DISPLAY_DEADLINE_MS);
+    scanner_watchdog_slot = TaskWatchdog::registerTask("ScannerTask", SCANNER_DEADLINE_MS);
+  }
+  
+  if (!startDisplayTask()) {
+    Serial_println("[TASK_MANAGER] ERROR: Failed to create display task!");
+    return;
+  }
+  
+  if (!startScannerTask()) {
+    Serial_println("[TASK_MANAGER] ERROR: Failed to create scanner task!");
+    return;
+  }
+  
+  Serial_println("[TASK_MANAGER] Tasks created successfully!");
+}
+
+bool TaskManager::startDisplayTask() {
   // Create display task (Core 1, higher priority)
-  BaseType_t result = xTaskCreatePinnedToCore(
+  BaseType_t result = RtosAlloc::createTask(
     displayTask,
     "DisplayTask",
     4096,        // Stack size: 4KB
     nullptr,
     3,           // Priority: 3 (higher)
     &display_task_handle,
-    1            // Core 1
+    1,           // Core 1
+    display_task_buffer
   );
   
   if (result != pdPASS) {
-    Serial_println("[TASK_MANAGER] ERROR: Failed to create display task!");
-    return;
+    display_task_handle = nullptr;
+    return false;
   }
   
+  TaskWatchdog::attach(display_watchdog_slot, display_task_handle);
+  return true;
+}
+
+bool TaskManager::startScannerTask() {
   // Create scanner task (Core 0, lower priority)
-  result = xTaskCreatePinnedToCore(
+  BaseType_t result = RtosAlloc::createTask(
     scannerTask,
     "ScannerTask",
     8192,        // Stack size: 8KB (increased to prevent overflow)
     nullptr,
     2,           // Priority: 2 (lower)
     &scanner_task_handle,
-    0            // Core 0
+    0,           // Core 0
+    scanner_task_buffer
   );
   
   if (result != pdPASS) {
-    Serial_println("[TASK_MANAGER] ERROR: Failed to create scanner task!");
-    return;
+    scanner_task_handle = nullptr;
+    return false;
   }
   
-  Serial_println("[TASK_MANAGER] Tasks created successfully!");
+  TaskWatchdog::attach(scanner_watchdog_slot, scanner_task_handle);
+  return true;
 }
 
 void TaskManager::displayTask(void* pv) {
   Serial_println("[DISPLAY_TASK] Started on Core 1");
   
+  // Touch pen-down wakes this task directly
+  TouchHandler::setNotifyTask(xTaskGetCurrentTaskHandle());
+  uint32_t wait = 0;
+  
   for (;;) {
-    // Process events from queue
+    // Sleep until a scanner event, a touch or the UI's own next deadline
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+    
+    // Apply everything the scanner queued (already merged per target)
     ScanEvent event;
-    while (receiveEvent(event, 0)) { // Non-blocking
+    while (receiveEvent(event)) { // Non-blocking
       if (displayManager) {
         switch (event.type) {
           case EV_SCAN_START:
@@ -157,22 +195,22 @@ void TaskManager::displayTask(void* pv) {
             displayManager->onScanCompleted();
             break;
           case EV_TARGET_UPDATE:
-            displayManager->updateTargetStatus(event.index, event.status, event.latency_ms);
+            displayManager->updateTargetStatus(event.index);
             break;
         }
       }
     }
     
     // Update display manager
-    if (displayManager) {
-      displayManager->update();
-    }
+    wait = displayManager ? displayManager->update() : 500;
     
-    // Feed watchdog
-    MemoryManager::getInstance().feedWatchdog();
+    // Heartbeat once per wake (at least every 500ms)
+    TaskWatchdog::feed(display_watchdog_slot);
     
-    // Small delay to prevent CPU hogging
-    vTaskDelay(pdMS_TO_TICKS(10));
+    // Always yield at least one tick, even when LVGL is already due
+    if (wait == 0) {
+      wait = 1;
+    }
   }
 }
 
@@ -215,8 +253,8 @@ void TaskManager::scannerTask(void* pv) {
       lastMemoryCheck = now;
     }
     
-    // Feed watchdog BEFORE any long operations
-    MemoryManager::getInstance().feedWatchdog();
+    // Heartbeat once per loop
+    TaskWatchdog::feed(scanner_watchdog_slot);
     
     // Update network monitor
     if (networkMonitor) {
@@ -229,10 +267,9 @@ void TaskManager::scannerTask(void* pv) {
       networkMonitor->update();
     }
     
-    // Feed watchdog AFTER network operations
-    MemoryManager::getInstance().feedWatchdog();
-    
-    // Adaptive delay based on activity
-    vTaskDelay(pdMS_TO_TICKS(20));
+    // Adaptive delay based on activity; with probes in flight, sleep on their sockets instead
+    if (!AsyncProbePool::waitForIo(20)) {
+      vTaskDelay(pdMS_TO_TICKS(20));
+    }
   }
 }
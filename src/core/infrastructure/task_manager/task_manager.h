@@ -3,6 +3,8 @@
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "core/domain/status/status.h"
+#include "core/infrastructure/scan_event_ring/scan_event_ring.h"
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
 #include <Arduino.h>
 
 // Forward declarations
@@ -14,9 +16,17 @@ private:
   // Task handles
   static TaskHandle_t display_task_handle;
   static TaskHandle_t scanner_task_handle;
+  static RtosAlloc::TaskBuffer display_task_buffer;
+  static RtosAlloc::TaskBuffer scanner_task_buffer;
   
-  // Event queue
-  static QueueHandle_t event_queue;
+  // Watchdog slots and deadlines (a synchronous probe may retry up to ~40s)
+  static int display_watchdog_slot;
+  static int scanner_watchdog_slot;
+  static const uint32_t DISPLAY_DEADLINE_MS = 5000;
+  static const uint32_t SCANNER_DEADLINE_MS = 60000;
+  
+  // Scanner -> display events (lock-free, target updates merged)
+  static ScanEventRing event_ring;
   
   // Dependencies (injected)
   static NetworkMonitor* networkMonitor;
@@ -41,16 +51,17 @@ public:
   // Dependency injection
   static void setDependencies(NetworkMonitor* nm, DisplayManager* dm);
   
-  // Event queue
-  static QueueHandle_t getEventQueue() { return event_queue; }
+  // Event ring: sendEvent() from the scanner task, receiveEvent() from the display task
   static bool sendEvent(const ScanEvent& event);
-  static bool receiveEvent(ScanEvent& event, uint32_t timeout_ms = 0);
+  static bool receiveEvent(ScanEvent& event);
+  static void printEventStatistics();
   
   // Status
   static bool isInitialized() { return initialized; }
   
 private:
   // Internal methods
-  static void createEventQueue();
   static void createTasks();
+  static bool startDisplayTask();
+  static bool startScannerTask();
 };
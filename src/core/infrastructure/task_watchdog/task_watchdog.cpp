@@ -0,0 +1,139 @@
+#include "core/infrastructure/task_watchdog/task_watchdog.h"
+#include "core/infrastructure/logger/logger.h"
+#include "esp_task_wdt.h"
+
+// Static member definitions
+TaskWatchdog::Entry TaskWatchdog::entries[MAX_TASKS];
+volatile TickType_t TaskWatchdog::heartbeats[MAX_TASKS];
+TaskHandle_t TaskWatchdog::supervisor_handle = nullptr;
+RtosAlloc::TaskBuffer TaskWatchdog::supervisor_buffer = {};
+portMUX_TYPE TaskWatchdog::lock = portMUX_INITIALIZER_UNLOCKED;
+bool TaskWatchdog::initialized = false;
+
+bool TaskWatchdog::initialize(uint32_t hardwareTimeoutS) {
+  if (initialized) return true;
+
+  Serial_println("[WATCHDOG] Initializing task watchdog...");
+
+  // The Arduino core usually has it running already (with its own timeout)
+  esp_err_t err = esp_task_wdt_init(hardwareTimeoutS, true);
+  if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+    Serial_printf("[WATCHDOG] ERROR: Hardware watchdog init failed (%d)\n", err);
+    return false;
+  }
+
+  // Above every worker task so a busy core can't starve the checks
+  BaseType_t result = RtosAlloc::createTask(
+    supervisorTask,
+    "Watchdog",
+    3072,
+    nullptr,
+    5,
+    &supervisor_handle,
+    tskNO_AFFINITY,
+    supervisor_buffer
+  );
+
+  if (result != pdPASS) {
+    Serial_println("[WATCHDOG] ERROR: Failed to create supervisor task!");
+    return false;
+  }
+
+  initialized = true;
+  Serial_printf("[WATCHDOG] Supervising task heartbeats, hardware timeout %lus\n", (unsigned long)hardwareTimeoutS);
+  return true;
+}
+
+int TaskWatchdog::registerTask(const char* name, uint32_t deadlineMs) {
+  portENTER_CRITICAL(&lock);
+  int slot = -1;
+  for (int i = 0; i < MAX_TASKS; i++) {
+    if (!entries[i].used) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot >= 0) {
+    Entry& entry = entries[slot];
+    entry.name = name;
+    entry.task = nullptr;
+    entry.deadline = pdMS_TO_TICKS(deadlineMs);
+    entry.misses = 0;
+    entry.used = true;
+    heartbeats[slot] = xTaskGetTickCount();
+  }
+  portEXIT_CRITICAL(&lock);
+
+  if (slot < 0) {
+    Serial_printf("[WATCHDOG] WARNING: No slot left for %s, not supervised\n", name);
+  }
+  return slot;
+}
+
+void TaskWatchdog::attach(int slot, TaskHandle_t task) {
+  if (slot < 0 || slot >= MAX_TASKS) return;
+  portENTER_CRITICAL(&lock);
+  entries[slot].task = task;
+  heartbeats[slot] = xTaskGetTickCount();
+  portEXIT_CRITICAL(&lock);
+}
+
+void TaskWatchdog::unregisterTask(int slot) {
+  if (slot < 0 || slot >= MAX_TASKS) return;
+  portENTER_CRITICAL(&lock);
+  entries[slot].used = false;
+  entries[slot].task = nullptr;
+  portEXIT_CRITICAL(&lock);
+}
+
+bool TaskWatchdog::checkTasks() {
+  bool healthy = true;
+
+  for (int i = 0; i < MAX_TASKS; i++) {
+    Entry& entry = entries[i];
+    if (!entry.used || !entry.task) continue;
+
+    TickType_t age = xTaskGetTickCount() - heartbeats[i];
+    if (age <= entry.deadline) continue;
+
+    entry.misses++;
+    Serial_printf("[WATCHDOG] %s missed its %lums deadline (last heartbeat %lums ago)\n", entry.name,
+                  (unsigned long)(entry.deadline * portTICK_PERIOD_MS), (unsigned long)(age * portTICK_PERIOD_MS));
+
+    // Never vTaskDelete() it: blocked in I/O, its stack still owns a socket,
+    // a TLS context and a session slot, and nothing would ever release them
+    Serial_printf("[WATCHDOG] CRITICAL: %s is hung, letting the hardware watchdog reboot\n", entry.name);
+    healthy = false;
+  }
+
+  return healthy;
+}
+
+void TaskWatchdog::supervisorTask(void* pv) {
+  Serial_println("[WATCHDOG] Supervisor started");
+  esp_task_wdt_add(nullptr);
+
+  for (;;) {
+    // Once a task is unrecoverable, stop resetting for good
+    if (checkTasks()) {
+      esp_task_wdt_reset();
+    } else {
+      vTaskSuspend(nullptr);
+    }
+    vTaskDelay(pdMS_TO_TICKS(CHECK_INTERVAL_MS));
+  }
+}
+
+void TaskWatchdog::printStatistics() {
+  Serial_println("\n=== TASK WATCHDOG ===");
+  TickType_t now = xTaskGetTickCount();
+  for (int i = 0; i < MAX_TASKS; i++) {
+    const Entry& entry = entries[i];
+    if (!entry.used) continue;
+    Serial_printf("%-16s deadline %6lums  last beat %6lums ago  misses %u%s\n", entry.name,
+                  (unsigned long)(entry.deadline * portTICK_PERIOD_MS),
+                  (unsigned long)((now - heartbeats[i]) * portTICK_PERIOD_MS), entry.misses,
+                  entry.task ? "" : "  (not running)");
+  }
+  Serial_println("=====================\n");
+}
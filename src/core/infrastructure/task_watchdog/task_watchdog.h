@@ -0,0 +1,61 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
+#include <Arduino.h>
+
+/**
+ * @brief Task Watchdog - Per-task deadlines on top of the ESP-IDF task watchdog
+ *
+ * Every long-running task owns a slot in a heartbeat table and beats it
+ * once per loop with feed(), a single store. A supervisor task checks each
+ * slot against that task's own deadline and is itself the only task
+ * subscribed to the hardware watchdog. A missed deadline is unrecoverable:
+ * the task is usually blocked inside a request, and deleting it there would
+ * leak its socket, TLS context and session slot, so the supervisor stops
+ * resetting the hardware watchdog and the chip reboots.
+ */
+class TaskWatchdog {
+public:
+  static const uint8_t MAX_TASKS = 12;
+
+private:
+  struct Entry {
+    const char* name;
+    TaskHandle_t task;        // nullptr until attached, not checked meanwhile
+    TickType_t deadline;
+    uint16_t misses;
+    bool used;
+  };
+
+  static Entry entries[MAX_TASKS];
+  static volatile TickType_t heartbeats[MAX_TASKS];
+  static TaskHandle_t supervisor_handle;
+  static RtosAlloc::TaskBuffer supervisor_buffer;
+  static portMUX_TYPE lock;
+  static bool initialized;
+
+  static const uint32_t CHECK_INTERVAL_MS = 1000;
+
+public:
+  // Starts the supervisor and subscribes it to the hardware watchdog
+  static bool initialize(uint32_t hardwareTimeoutS);
+
+  // Reserve a slot before creating the task, so the task can feed from its first loop
+  static int registerTask(const char* name, uint32_t deadlineMs);
+  static void attach(int slot, TaskHandle_t task);
+  static void unregisterTask(int slot);
+
+  // Heartbeat, called once per loop by the owning task
+  static inline void feed(int slot) {
+    if (slot >= 0) heartbeats[slot] = xTaskGetTickCount();
+  }
+
+  // Status
+  static bool isInitialized() { return initialized; }
+  static void printStatistics();
+
+private:
+  static void supervisorTask(void* pv);
+  static bool checkTasks();
+};
@@ -0,0 +1,40 @@
+#include "core/infrastructure/telegram_service/html_escape.h"
+#include <string.h>
+
+const char* escapeHtml(const char* src, char* out, size_t size) {
+  if (size == 0) {
+    return out;
+  }
+
+  size_t pos = 0;
+  size_t i = 0;
+  for (; src[i] != '\0'; i++) {
+    const char* entity = nullptr;
+    switch (src[i]) {
+      case '&': entity = "&amp;"; break;
+      case '<': entity = "&lt;"; break;
+      case '>': entity = "&gt;"; break;
+      case '"': entity = "&quot;"; break;
+      default: break;
+    }
+
+    size_t length = entity ? strlen(entity) : 1;
+    if (pos + length >= size) break;
+    if (entity) {
+      memcpy(out + pos, entity, length);
+    } else {
+      out[pos] = src[i];
+    }
+    pos += length;
+  }
+
+  // Truncated inside a UTF-8 sequence: drop its leading bytes too
+  if (src[i] != '\0') {
+    while (pos > 0 && ((unsigned char)src[i] & 0xC0) == 0x80) {
+      i--;
+      pos--;
+    }
+  }
+  out[pos] = '\0';
+  return out;
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <stddef.h>
+
+// Buffer size that always holds escapeHtml() of n characters ('&' -> "&amp;")
+#define HTML_ESCAPED_SIZE(n) ((n) * 5 + 1)
+
+/**
+ * @brief Escape text interpolated into a parse_mode HTML message
+ *
+ * Replaces & < > " with entities so target names and chat queries render
+ * as text instead of opening tags or entities (Telegram rejects the whole
+ * message on malformed HTML). Output that does not fit is cut at a
+ * character boundary, never inside an entity or a UTF-8 sequence.
+ * @return out, always NUL-terminated
+ */
+const char* escapeHtml(const char* src, char* out, size_t size);
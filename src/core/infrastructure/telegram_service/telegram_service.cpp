@@ -1,29 +1,28 @@
 #include "core/infrastructure/telegram_service/telegram_service.h"
+#include "core/infrastructure/telegram_service/html_escape.h"
 #include "core/infrastructure/http_client/http_client.h"
-#include "core/domain/alert/alert.h"
-#include "core/infrastructure/ssl_mutex_manager/ssl_mutex_manager.h"
+#include "core/infrastructure/tls_budget/tls_budget.h"
 #include "core/infrastructure/memory_manager/memory_manager.h"
+#include "core/infrastructure/dns_cache/dns_cache.h"
+#include "core/infrastructure/cpu_monitor/cpu_monitor.h"
 #include "core/infrastructure/ntp_service/ntp_service.h"
-#include <ArduinoJson.h>
 #include "core/infrastructure/logger/logger.h"
+#include "config/config_loader/config_loader.h"
+#include <ArduinoJson.h>
+#include <WiFiClientSecure.h>
+
+static const char* TELEGRAM_API_HOST = "api.telegram.org";
 
-TelegramService::TelegramService() : enabled(false), sendingMessage(false) {
-  // Initialize alert array
-  for (int i = 0; i < 6; i++) {
-    alerts[i] = nullptr;
+TelegramService::TelegramService()
+  : enabled(false), sendingMessage(false), commandsEnabled(false),
+    pollIntervalMs(10000), lastPollTime(0), nextUpdateId(0) {
+  for (int i = 0; i < MAX_TARGETS; i++) {
     lastMessageIds[i] = 0;
     isThreadActive[i] = false;
   }
 }
 
 TelegramService::~TelegramService() {
-  // Clean up alert objects
-  for (int i = 0; i < 6; i++) {
-    if (alerts[i]) {
-      delete alerts[i];
-      alerts[i] = nullptr;
-    }
-  }
 }
 
 bool TelegramService::initialize(const String& botToken, const String& chatId, bool enabled) {
@@ -41,245 +40,511 @@ bool TelegramService::initialize(const String& botToken, const String& chatId, b
   this->chatId = chatId;
   this->enabled = true;
 
-  // Initialize alert objects
-  for (int i = 0; i < 6; i++) {
-    if (!alerts[i]) {
-      alerts[i] = new Alert(i, "Target " + String(i));
-    }
-  }
-
   Serial_println("[TELEGRAM] Service initialized successfully");
   return true;
 }
 
-void TelegramService::updateTargetStatus(int targetIndex, Status newStatus, uint16_t latency, const String& targetName) {
-  if (!enabled || targetIndex < 0 || targetIndex >= 6 || !alerts[targetIndex]) {
-    return;
-  }
-
-  Alert* alert = alerts[targetIndex];
-  alert->updateStatus(newStatus, latency);
-
-  if (alert->shouldSendAlert() && isTimeForAlert(targetIndex)) {
-    sendAlert(targetIndex, targetName, newStatus, latency);
-  } else if (alert->shouldSendRecovery() && isTimeForAlert(targetIndex, true)) {
-    sendRecoveryAlert(targetIndex, targetName, latency);
-  }
+void TelegramService::setCommandPolling(bool enabled, unsigned long intervalMs) {
+  commandsEnabled = enabled;
+  pollIntervalMs = intervalMs < 3000 ? 3000 : intervalMs;
+  Serial_printf("[TELEGRAM] Chat commands %s (poll every %lums)\n", enabled ? "enabled" : "disabled", pollIntervalMs);
 }
 
-void TelegramService::sendAlert(int targetIndex, const String& targetName, Status status, uint16_t latency) {
+bool TelegramService::send(const NotificationEvent& event) {
   if (!enabled || sendingMessage) {
-    return;
+    return false;
   }
 
   sendingMessage = true;
-  // Get current downtime for DOWN alerts
-  unsigned long currentDowntime = alerts[targetIndex] ? alerts[targetIndex]->getDowntime() : 0;
-  String message = formatAlertMessage(targetName, status, latency, false, currentDowntime);
-  
-  // Send alert with reply thread support (isRecovery = false for down alerts)
-  if (sendMessage(message, targetIndex, false)) {
-    if (alerts[targetIndex]) {
-      alerts[targetIndex]->markAlertSent();
+  bool isRecovery = event.type == NotificationType::RECOVERY;
+  size_t textStart = beginPayload(event.targetIndex);
+  size_t textLength;
+  
+  if (event.type == NotificationType::FLAP_START || event.type == NotificationType::FLAP_END) {
+    textLength = formatFlapMessage(payloadBuffer + textStart, PAYLOAD_BUFFER_SIZE - textStart, event);
+  } else if (event.type == NotificationType::LATENCY_DEGRADED || event.type == NotificationType::LATENCY_RESTORED) {
+    textLength = formatLatencyMessage(payloadBuffer + textStart, PAYLOAD_BUFFER_SIZE - textStart, event);
+  } else if (isRecovery) {
+    textLength = formatRecoveryMessage(payloadBuffer + textStart, PAYLOAD_BUFFER_SIZE - textStart,
+                                       event.targetName, event.latency, event.downtimeSeconds,
+                                       event.firstFailureTime, event.alertStartTime);
+  } else {
+    // The target is still down while the event waits in the queue or backs off
+    unsigned long downtime = event.downtimeSeconds + (millis() - event.createdAt) / 1000;
+    textLength = formatAlertMessage(payloadBuffer + textStart, PAYLOAD_BUFFER_SIZE - textStart,
+                                    event.targetName, event.status, event.latency, false, downtime);
+    
+    // Root-cause alert: dependents behind this target are not alerted separately
+    if (event.dependentCount > 0) {
+      textLength = appendf(payloadBuffer + textStart, PAYLOAD_BUFFER_SIZE - textStart, textLength,
+                           "\n\n🔗 <b>Root cause:</b> %u dependent target(s) unreachable",
+                           (unsigned)event.dependentCount);
     }
-    Serial_printf("[TELEGRAM] Alert sent for target %d (%s) - Thread: %s\n", 
-                  targetIndex, targetName.c_str(), 
-                  isThreadActive[targetIndex] ? "Reply" : "New");
+  }
+  
+  // Reply thread support (recovery ends the thread)
+  bool sent = sendPayload(finishPayload(textStart, textLength), event.targetIndex, isRecovery);
+  if (sent) {
+    Serial_printf("[TELEGRAM] Sent %s for target %d (%s)\n", getNotificationTypeName(event.type),
+                  event.targetIndex, event.targetName);
   } else {
-    Serial_printf("[TELEGRAM] Failed to send alert for target %d (%s)\n", targetIndex, targetName.c_str());
+    Serial_printf("[TELEGRAM] Failed to send %s for target %d (%s)\n", getNotificationTypeName(event.type),
+                  event.targetIndex, event.targetName);
   }
   
   sendingMessage = false;
+  return sent;
 }
 
-void TelegramService::sendRecoveryAlert(int targetIndex, const String& targetName, uint16_t latency) {
-  if (!enabled || sendingMessage) {
+void TelegramService::sendTestMessage(const String* targetNames, int targetCount) {
+  if (!enabled) {
+    Serial_println("[TELEGRAM] Service not active, skipping test message");
     return;
   }
 
-  sendingMessage = true;
+  size_t textStart = beginPayload(-1);
+  size_t textLength = formatTestMessage(payloadBuffer + textStart, PAYLOAD_BUFFER_SIZE - textStart, targetNames, targetCount);
+  sendPayload(finishPayload(textStart, textLength));
+}
+
+void TelegramService::poll() {
+  if (!enabled || !commandsEnabled || sendingMessage) {
+    return;
+  }
   
-  // Get alert timing information
-  Alert* alert = alerts[targetIndex];
-  unsigned long totalDowntime = alert ? alert->getDowntime() : 0;
-  unsigned long firstFailureTime = alert ? alert->getFirstFailureTime() : 0;
-  unsigned long alertStartTime = alert ? alert->getAlertDowntimeStart() : 0;
+  unsigned long now = millis();
+  if (now - lastPollTime < pollIntervalMs) {
+    return;
+  }
+  lastPollTime = now;
   
-  String message = formatRecoveryMessage(targetName, latency, totalDowntime, firstFailureTime, alertStartTime);
+  char commands[MAX_UPDATES_PER_POLL][COMMAND_TEXT_SIZE];
+  int count = fetchCommands(commands, MAX_UPDATES_PER_POLL);
   
-  // Send recovery with reply thread support (isRecovery = true ends the thread)
-  if (sendMessage(message, targetIndex, true)) {
-    if (alert) {
-      alert->markRecovered();
-      // Reset alert data for clean state - ready for next alert
-      alert->reset();
-    }
-    Serial_printf("[TELEGRAM] Recovery alert sent for target %d (%s) - Thread ended\n", targetIndex, targetName.c_str());
-  } else {
-    Serial_printf("[TELEGRAM] Failed to send recovery alert for target %d (%s)\n", targetIndex, targetName.c_str());
+  // Replies are sent after the getUpdates request has returned its TLS slot
+  for (int i = 0; i < count; i++) {
+    handleCommand(commands[i]);
   }
-  
-  sendingMessage = false;
 }
 
-void TelegramService::sendTestMessage(const String* targetNames, int targetCount) {
-  if (!enabled) {
-    Serial_println("[TELEGRAM] Service not active, skipping test message");
-    return;
+int TelegramService::fetchCommands(char commands[][COMMAND_TEXT_SIZE], int maxCommands) {
+  if (WiFi.status() != WL_CONNECTED || MemoryManager::getInstance().isMemoryLow()) {
+    return 0;
   }
-
-  String testMessage = "🤖 <b>Nebula Monitor v2.4</b>\n";
-  testMessage += "✅ <b>System Initialized Successfully!</b>\n\n";
   
-  // WiFi Status
-  if (WiFi.status() == WL_CONNECTED) {
-    testMessage += "📶 <b>WiFi:</b> Connected\n";
-    testMessage += "🌐 <b>IP:</b> " + WiFi.localIP().toString() + "\n";
-    testMessage += "📡 <b>RSSI:</b> " + String(WiFi.RSSI()) + " dBm\n\n";
-  } else {
-    testMessage += "📶 <b>WiFi:</b> Disconnected\n\n";
+  // Don't queue behind other TLS users, try again next interval
+  TlsSlot tlsSlot(TlsBudget::PRIORITY_COMMAND, 500);
+  if (!tlsSlot.isHeld()) {
+    return 0;
   }
   
-  // Services Status
-  testMessage += "🔧 <b>Services:</b>\n";
-  testMessage += "• Telegram: ✅ Active\n";
-  testMessage += "• Display: ✅ Active\n";
-  testMessage += "• Network Monitor: ✅ Active\n";
-  testMessage += "• Task Manager: ✅ Active\n\n";
+  WiFiClientSecure client;
+  client.setInsecure();
+  HTTPClient http;
+  char url[256];
+  snprintf(url, sizeof(url),
+           "https://api.telegram.org/bot%s/getUpdates?offset=%ld&limit=%u&timeout=%u&allowed_updates=%%5B%%22message%%22%%5D",
+           botToken.c_str(), (long)nextUpdateId, (unsigned)maxCommands, (unsigned)LONG_POLL_TIMEOUT_S);
   
-  // Targets Info
-  testMessage += "🎯 <b>Monitoring Targets:</b>\n";
-  if (targetNames && targetCount > 0) {
-    for (int i = 0; i < targetCount; i++) {
-      if (targetNames[i].length() > 0) {
-        testMessage += "• " + targetNames[i] + "\n";
-      }
+  if (!DnsCache::connect(client, TELEGRAM_API_HOST, 443) || !http.begin(client, url)) {
+    return 0;
+  }
+  http.setTimeout((LONG_POLL_TIMEOUT_S + 5) * 1000);
+  
+  int httpResponseCode = http.GET();
+  if (httpResponseCode != 200) {
+    http.end();
+    Serial_printf("[TELEGRAM] getUpdates failed, code: %d\n", httpResponseCode);
+    return 0;
+  }
+  
+  String body = http.getString();
+  http.end();
+  
+  // Keep only the fields we need
+  StaticJsonDocument<128> filter;
+  filter["result"][0]["update_id"] = true;
+  filter["result"][0]["message"]["chat"]["id"] = true;
+  filter["result"][0]["message"]["text"] = true;
+  
+  DynamicJsonDocument doc(1024);
+  DeserializationError error = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+  if (error) {
+    Serial_printf("[TELEGRAM] getUpdates parse error: %s\n", error.c_str());
+    return 0;
+  }
+  
+  int count = 0;
+  JsonArray updates = doc["result"].as<JsonArray>();
+  for (JsonObject update : updates) {
+    int32_t updateId = update["update_id"] | 0;
+    if (updateId >= nextUpdateId) {
+      nextUpdateId = updateId + 1; // Acknowledge on the next poll
     }
-  } else {
-    testMessage += "• No targets configured\n";
+    
+    // Only the configured chat may query the monitor
+    char fromChat[24];
+    snprintf(fromChat, sizeof(fromChat), "%lld", update["message"]["chat"]["id"].as<long long>());
+    const char* text = update["message"]["text"] | "";
+    if (chatId != fromChat || text[0] != '/' || count >= maxCommands) {
+      continue;
+    }
+    
+    strncpy(commands[count], text, COMMAND_TEXT_SIZE - 1);
+    commands[count][COMMAND_TEXT_SIZE - 1] = '\0';
+    count++;
   }
   
-  testMessage += "\n⏰ <b>Scan Interval:</b> 30s\n";
-  testMessage += "🚨 <b>Alert Threshold:</b> 3 failures\n";
-  testMessage += "⏱️ <b>Cooldown:</b> 5 minutes\n\n";
-  testMessage += "🔄 <b>System is now monitoring...</b>";
+  return count;
+}
+
+void TelegramService::handleCommand(const char* text) {
+  // Split "/command[@bot] argument"
+  const char* argument = strchr(text, ' ');
+  size_t commandLength = argument ? (size_t)(argument - text) : strlen(text);
+  const char* mention = (const char*)memchr(text, '@', commandLength);
+  if (mention) {
+    commandLength = mention - text;
+  }
+  while (argument && *argument == ' ') {
+    argument++;
+  }
+  
+  Serial_printf("[TELEGRAM] Command received: %s\n", text);
+  
+  size_t textStart = beginPayload(-1);
+  char* dst = payloadBuffer + textStart;
+  size_t size = PAYLOAD_BUFFER_SIZE - textStart;
+  size_t textLength;
+  
+  // Read the published snapshot in place, the view is gone before the send
+  if (commandLength == 7 && strncmp(text, "/status", 7) == 0) {
+    SnapshotView snapshot;
+    textLength = formatStatusReply(dst, size, *snapshot);
+  } else if (commandLength == 7 && strncmp(text, "/target", 7) == 0 && argument && *argument) {
+    SnapshotView snapshot;
+    textLength = formatTargetReply(dst, size, *snapshot, argument);
+  } else {
+    textLength = formatHelpReply(dst, size);
+  }
   
-  sendMessage(testMessage);
+  sendPayload(finishPayload(textStart, textLength));
 }
 
-bool TelegramService::isActive() const {
-  return enabled;
+size_t TelegramService::formatStatusReply(char* dst, size_t size, const StatusSnapshot& snap) {
+  char duration[24];
+  unsigned long now = millis();
+  int online = 0;
+  
+  size_t pos = appendf(dst, size, 0, "📊 <b>Nebula Monitor Status</b>\n\n");
+  
+  for (int i = 0; i < snap.targetCount; i++) {
+    const TargetSnapshot& t = snap.targets[i];
+    char name[HTML_ESCAPED_SIZE(sizeof(t.name))];
+    escapeHtml(t.name, name, sizeof(name));
+    if (t.maintenance) {
+      pos = appendf(dst, size, pos, "🔧 <b>%s</b> — MAINTENANCE (%s)\n", name, getStatusName(t.status));
+    } else if (t.flapping) {
+      pos = appendf(dst, size, pos, "🟠 <b>%s</b> — FLAPPING (%s)\n", name, getStatusName(t.status));
+    } else if (t.status == UP) {
+      online++;
+      pos = appendf(dst, size, pos, "%s <b>%s</b> — %ums\n", t.latencyDegraded ? "🐢" : "🟢", name, (unsigned)t.latency);
+    } else if (t.status == DOWN) {
+      pos = appendf(dst, size, pos, "🔴 <b>%s</b> — DOWN for %s\n", name,
+                    formatTime((now - t.lastChangeAt) / 1000, duration, sizeof(duration)));
+    } else if (t.status == UNREACHABLE) {
+      pos = appendf(dst, size, pos, "⚫ <b>%s</b> — UNREACHABLE (parent down)\n", name);
+    } else {
+      pos = appendf(dst, size, pos, "🟡 <b>%s</b> — UNKNOWN\n", name);
+    }
+  }
+  
+  pos = appendf(dst, size, pos,
+                "\n✅ <b>Online:</b> %d/%d\n"
+                "🕐 <b>Updated:</b> %s ago",
+                online, (int)snap.targetCount,
+                formatTime((now - snap.publishedAt) / 1000, duration, sizeof(duration)));
+  
+  uint16_t core0 = CpuMonitor::getCoreLoad(0);
+  uint16_t core1 = CpuMonitor::getCoreLoad(1);
+  if (core0 != CpuMonitor::NO_DATA) {
+    pos = appendf(dst, size, pos, "\n⚙️ <b>CPU:</b> %u.%u%% / %u.%u%%", core0 / 10, core0 % 10, core1 / 10, core1 % 10);
+  }
+  return pos;
 }
 
-bool TelegramService::hasActiveAlerts() const {
-  if (!enabled) return false;
+size_t TelegramService::formatTargetReply(char* dst, size_t size, const StatusSnapshot& snap, const char* query) {
+  // Exact (case-insensitive) name first, then prefix match
+  const TargetSnapshot* match = nullptr;
+  size_t queryLength = strlen(query);
+  for (int i = 0; i < snap.targetCount && !match; i++) {
+    if (strcasecmp(snap.targets[i].name, query) == 0) {
+      match = &snap.targets[i];
+    }
+  }
+  for (int i = 0; i < snap.targetCount && !match; i++) {
+    if (strncasecmp(snap.targets[i].name, query, queryLength) == 0) {
+      match = &snap.targets[i];
+    }
+  }
   
-  for (int i = 0; i < 6; i++) {
-    if (alerts[i] && alerts[i]->isAlertActive()) {
-      return true;
+  if (!match) {
+    char queryText[HTML_ESCAPED_SIZE(COMMAND_TEXT_SIZE)];
+    escapeHtml(query, queryText, sizeof(queryText));
+    return appendf(dst, size, 0, "❓ <b>Unknown target:</b> %s\n\nUse /status to list targets.", queryText);
+  }
+  
+  char name[HTML_ESCAPED_SIZE(sizeof(match->name))];
+  escapeHtml(match->name, name, sizeof(name));
+  char lastCheck[24] = "never";
+  char inState[24] = "-";
+  unsigned long now = millis();
+  if (match->lastCheckAt > 0) {
+    formatTime((now - match->lastCheckAt) / 1000, lastCheck, sizeof(lastCheck));
+    formatTime((now - match->lastChangeAt) / 1000, inState, sizeof(inState));
+  }
+  
+  size_t len = appendf(dst, size, 0,
+                 "🎯 <b>%s</b>\n\n"
+                 "📶 <b>Status:</b> %s\n"
+                 "📊 <b>Latency:</b> %ums (p95 ~%ums%s)\n"
+                 "🕐 <b>Last Check:</b> %s ago\n"
+                 "⏱️ <b>In State For:</b> %s\n"
+                 "⚠️ <b>Failures:</b> %u\n"
+                 "🚨 <b>Alert:</b> %s%s",
+                 name, getStatusName(match->status),
+                 (unsigned)match->latency, (unsigned)match->p95Latency,
+                 match->latencyDegraded ? ", above SLO" : "", lastCheck, inState,
+                 (unsigned)match->failureCount, match->alertActive ? "Active" : "None",
+                 match->flapping ? "\n🟠 <b>Flapping:</b> alerts held" : "");
+  
+  if (match->maintenance) {
+    len = appendf(dst, size, len, "\n🔧 <b>Maintenance:</b> in window, alerts suppressed");
+  }
+  
+  // Rolling availability, permille per window
+  static const char* const windowNames[SLA_WINDOW_COUNT] = { "1h", "24h", "7d" };
+  len = appendf(dst, size, len, "\n📈 <b>Availability:</b>");
+  for (uint8_t w = 0; w < SLA_WINDOW_COUNT; w++) {
+    uint16_t permille = match->availability[w];
+    if (permille == SLA_NO_DATA) {
+      len = appendf(dst, size, len, "\n   %s: no data", windowNames[w]);
+    } else {
+      len = appendf(dst, size, len, "\n   %s: %u.%u%% (mean %ums)", windowNames[w],
+                    permille / 10, permille % 10, (unsigned)match->meanLatency[w]);
     }
   }
-  return false;
+  return len;
 }
 
-int TelegramService::getFailureCount(int targetIndex) const {
-  if (targetIndex < 0 || targetIndex >= 6 || !alerts[targetIndex]) {
-    return 0;
-  }
-  return alerts[targetIndex]->getFailureCount();
+size_t TelegramService::formatHelpReply(char* dst, size_t size) {
+  return appendf(dst, size, 0,
+                 "🤖 <b>Nebula Monitor Commands</b>\n\n"
+                 "/status — all targets\n"
+                 "/target &lt;name&gt; — details for one target");
+}
+
+bool TelegramService::isActive() const {
+  return enabled;
 }
 
-String TelegramService::formatAlertMessage(const String& targetName, Status status, uint16_t latency, bool isRecovery, unsigned long totalDowntime) {
-  String message = "";
+size_t TelegramService::formatAlertMessage(char* dst, size_t size, const char* targetName, Status status, uint16_t latency,
+                                           bool isRecovery, unsigned long totalDowntime) {
+  char name[HTML_ESCAPED_SIZE(sizeof(NotificationEvent::targetName))];
+  escapeHtml(targetName, name, sizeof(name));
+  char downtime[24];
+  size_t pos = 0;
   
   if (isRecovery) {
-    message += "🟢 <b>SYSTEM ONLINE</b>\n\n";
-    message += "🎉 <b>Target:</b> " + targetName + "\n\n";
-    message += "⏱️ <b>Downtime:</b> " + formatTime(totalDowntime) + "\n";
-    message += "📊 <b>Current Latency:</b> " + String(latency) + "ms\n\n";
-    message += "✅ <b>Service is back online!</b>";
+    pos = appendf(dst, size, pos,
+                  "🟢 <b>SYSTEM ONLINE</b>\n\n"
+                  "🎉 <b>Target:</b> %s\n\n"
+                  "⏱️ <b>Downtime:</b> %s\n"
+                  "📊 <b>Current Latency:</b> %ums\n\n"
+                  "✅ <b>Service is back online!</b>",
+                  name, formatTime(totalDowntime, downtime, sizeof(downtime)), (unsigned)latency);
   } else if (status == DOWN) {
-    message += "🚨 <b>SYSTEM DOWN!</b>\n\n";
-    message += "🔴 <b>Target:</b> " + targetName + "\n\n";
-    message += "🕐 <b>Detected:</b> " + NTPService::getCurrentDateTime() + "\n";
-    message += "⏱️ <b>Downtime:</b> " + formatTime(totalDowntime) + "\n";
-    message += "⚠️ <b>Status:</b> Unreachable\n\n";
-    message += "🔍 <b>Waiting for recovery...</b>";
+    String detected = NTPService::getCurrentDateTime();
+    pos = appendf(dst, size, pos,
+                  "🚨 <b>SYSTEM DOWN!</b>\n\n"
+                  "🔴 <b>Target:</b> %s\n\n"
+                  "🕐 <b>Detected:</b> %s\n"
+                  "⏱️ <b>Downtime:</b> %s\n"
+                  "⚠️ <b>Status:</b> Unreachable\n\n"
+                  "🔍 <b>Waiting for recovery...</b>",
+                  name, detected.c_str(), formatTime(totalDowntime, downtime, sizeof(downtime)));
   } else {
-    message += "❓ <b>UNKNOWN STATUS</b>\n\n";
-    message += "🟡 <b>Target:</b> " + targetName + "\n";
-    message += "📊 <b>Response:</b> " + String(latency) + "ms\n";
-    message += "🕐 <b>Detected:</b> " + NTPService::getCurrentDateTime() + "\n\n";
-    message += "⚠️ <b>Possible causes:</b>\n";
-    message += "• DNS resolution timeout\n";
-    message += "• SSL handshake failure\n";
-    message += "• Network instability\n\n";
-    message += "🔍 <b>Status unclear, waiting...</b>";
-  }
-  
-  return message;
+    String detected = NTPService::getCurrentDateTime();
+    pos = appendf(dst, size, pos,
+                  "❓ <b>UNKNOWN STATUS</b>\n\n"
+                  "🟡 <b>Target:</b> %s\n"
+                  "📊 <b>Response:</b> %ums\n"
+                  "🕐 <b>Detected:</b> %s\n\n"
+                  "⚠️ <b>Possible causes:</b>\n"
+                  "• DNS resolution timeout\n"
+                  "• SSL handshake failure\n"
+                  "• Network instability\n\n"
+                  "🔍 <b>Status unclear, waiting...</b>",
+                  name, (unsigned)latency, detected.c_str());
+  }
+  
+  return pos;
 }
 
-String TelegramService::formatRecoveryMessage(const String& targetName, uint16_t latency, unsigned long totalDowntime, 
-                                             unsigned long firstFailureTime, unsigned long alertStartTime) {
-  String message = "";
-  
-  message += "🟢 <b>SYSTEM RECOVERED</b>\n\n";
-  message += "🎉 <b>Target:</b> " + targetName + "\n\n";
-  
-  // Calculate times
-  unsigned long currentTime = millis();
-  unsigned long recoveryTime = currentTime;
+size_t TelegramService::formatRecoveryMessage(char* dst, size_t size, const char* targetName, uint16_t latency, unsigned long totalDowntime,
+                                              unsigned long firstFailureTime, unsigned long alertStartTime) {
+  char name[HTML_ESCAPED_SIZE(sizeof(NotificationEvent::targetName))];
+  escapeHtml(targetName, name, sizeof(name));
+  char failureStartTime[24] = "Unknown";
+  char downtime[24];
   
   // Format failure start time (if available)
-  String failureStartTime = "Unknown";
   if (firstFailureTime > 0) {
     // Convert millis to real time using NTP
-    failureStartTime = convertMillisToRealTime(firstFailureTime);
+    convertMillisToRealTime(firstFailureTime, failureStartTime, sizeof(failureStartTime));
   }
   
-  // Format alert start time (if available)
-  String alertStartTimeStr = "Unknown";
-  if (alertStartTime > 0) {
-    // Convert millis to real time using NTP
-    alertStartTimeStr = convertMillisToRealTime(alertStartTime);
+  // Format recovery time
+  String recoveryTime = NTPService::getCurrentDateTime();
+  
+  return appendf(dst, size, 0,
+                 "🟢 <b>SYSTEM RECOVERED</b>\n\n"
+                 "🎉 <b>Target:</b> %s\n\n"
+                 "🕐 <b>First Failure:</b> %s\n"
+                 "✅ <b>Recovered At:</b> %s\n\n"
+                 "⏱️ <b>Total Downtime:</b> %s\n"
+                 "📊 <b>Current Latency:</b> %ums\n"
+                 "🔄 <b>Status:</b> Online\n\n"
+                 "✅ <b>Service is fully operational!</b>",
+                 name, failureStartTime, recoveryTime.c_str(),
+                 formatTime(totalDowntime, downtime, sizeof(downtime)), (unsigned)latency);
+}
+
+size_t TelegramService::formatFlapMessage(char* dst, size_t size, const NotificationEvent& event) {
+  char name[HTML_ESCAPED_SIZE(sizeof(NotificationEvent::targetName))];
+  escapeHtml(event.targetName, name, sizeof(name));
+  String detected = NTPService::getCurrentDateTime();
+  
+  if (event.type == NotificationType::FLAP_START) {
+    return appendf(dst, size, 0,
+                   "🟠 <b>TARGET FLAPPING</b>\n\n"
+                   "🔀 <b>Target:</b> %s\n\n"
+                   "🕐 <b>Detected:</b> %s\n"
+                   "📈 <b>State Change:</b> %u%% of recent checks\n\n"
+                   "🔕 <b>Alerts held until the target stabilizes</b>",
+                   name, detected.c_str(), (unsigned)event.changePercent);
   }
   
-  // Format recovery time
-  String recoveryTimeStr = NTPService::getCurrentDateTime();
+  char duration[24];
+  return appendf(dst, size, 0,
+                 "🔵 <b>FLAPPING ENDED</b>\n\n"
+                 "🔀 <b>Target:</b> %s\n\n"
+                 "🕐 <b>Stable Since:</b> %s\n"
+                 "⏱️ <b>Flapped For:</b> %s\n"
+                 "🔁 <b>State Changes:</b> %u\n"
+                 "📶 <b>Current Status:</b> %s",
+                 name, detected.c_str(),
+                 formatTime(event.downtimeSeconds, duration, sizeof(duration)),
+                 (unsigned)event.stateChanges, getStatusName(event.status));
+}
+
+size_t TelegramService::formatLatencyMessage(char* dst, size_t size, const NotificationEvent& event) {
+  char name[HTML_ESCAPED_SIZE(sizeof(NotificationEvent::targetName))];
+  escapeHtml(event.targetName, name, sizeof(name));
+  String detected = NTPService::getCurrentDateTime();
+  
+  if (event.type == NotificationType::LATENCY_DEGRADED) {
+    return appendf(dst, size, 0,
+                   "🐢 <b>LATENCY DEGRADED</b>\n\n"
+                   "🟡 <b>Target:</b> %s\n\n"
+                   "🕐 <b>Detected:</b> %s\n"
+                   "📊 <b>p95 Latency:</b> ~%ums\n"
+                   "🎯 <b>SLO:</b> %ums\n\n"
+                   "⚠️ <b>Service is up but slow</b>",
+                   name, detected.c_str(), (unsigned)event.latency, (unsigned)event.thresholdMs);
+  }
   
-  message += "🕐 <b>First Failure:</b> " + failureStartTime + "\n";
-  message += "✅ <b>Recovered At:</b> " + recoveryTimeStr + "\n\n";
+  char duration[24];
+  return appendf(dst, size, 0,
+                 "⚡ <b>LATENCY RESTORED</b>\n\n"
+                 "🟢 <b>Target:</b> %s\n\n"
+                 "🕐 <b>Restored At:</b> %s\n"
+                 "⏱️ <b>Degraded For:</b> %s\n"
+                 "📊 <b>p95 Latency:</b> ~%ums (SLO %ums)",
+                 name, detected.c_str(),
+                 formatTime(event.downtimeSeconds, duration, sizeof(duration)),
+                 (unsigned)event.latency, (unsigned)event.thresholdMs);
+}
+
+size_t TelegramService::formatTestMessage(char* dst, size_t size, const String* targetNames, int targetCount) {
+  size_t pos = appendf(dst, size, 0,
+                       "🤖 <b>Nebula Monitor v2.4</b>\n"
+                       "✅ <b>System Initialized Successfully!</b>\n\n");
+  
+  // WiFi Status
+  if (WiFi.status() == WL_CONNECTED) {
+    IPAddress ip = WiFi.localIP();
+    pos = appendf(dst, size, pos,
+                  "📶 <b>WiFi:</b> Connected\n"
+                  "🌐 <b>IP:</b> %u.%u.%u.%u\n"
+                  "📡 <b>RSSI:</b> %d dBm\n\n",
+                  ip[0], ip[1], ip[2], ip[3], (int)WiFi.RSSI());
+  } else {
+    pos = appendf(dst, size, pos, "📶 <b>WiFi:</b> Disconnected\n\n");
+  }
   
-  message += "⏱️ <b>Total Downtime:</b> " + formatTime(totalDowntime) + "\n";
-  message += "📊 <b>Current Latency:</b> " + String(latency) + "ms\n";
-  message += "🔄 <b>Status:</b> Online\n\n";
+  // Services Status
+  pos = appendf(dst, size, pos,
+                "🔧 <b>Services:</b>\n"
+                "• Telegram: ✅ Active\n"
+                "• Display: ✅ Active\n"
+                "• Network Monitor: ✅ Active\n"
+                "• Task Manager: ✅ Active\n\n"
+                "🎯 <b>Monitoring Targets:</b>\n");
   
-  message += "✅ <b>Service is fully operational!</b>";
+  // Targets Info
+  if (targetNames && targetCount > 0) {
+    for (int i = 0; i < targetCount; i++) {
+      if (targetNames[i].length() > 0) {
+        char name[HTML_ESCAPED_SIZE(sizeof(NotificationEvent::targetName))];
+        pos = appendf(dst, size, pos, "• %s\n", escapeHtml(targetNames[i].c_str(), name, sizeof(name)));
+      }
+    }
+  } else {
+    pos = appendf(dst, size, pos, "• No targets configured\n");
+  }
   
-  return message;
+  char cooldown[24];
+  return appendf(dst, size, pos,
+                 "\n⏰ <b>Scan Interval:</b> 30s\n"
+                 "🚨 <b>Alert Threshold:</b> %d failures\n"
+                 "⏱️ <b>Cooldown:</b> %s\n\n"
+                 "🔄 <b>System is now monitoring...</b>",
+                 ConfigLoader::getMaxFailuresBeforeAlert(),
+                 formatTime(ConfigLoader::getAlertCooldownMs() / 1000, cooldown, sizeof(cooldown)));
 }
 
-String TelegramService::formatTime(unsigned long seconds) const {
+const char* TelegramService::formatTime(unsigned long seconds, char* out, size_t size) const {
   if (seconds < 60) {
-    return String(seconds) + "s";
+    snprintf(out, size, "%lus", seconds);
   } else if (seconds < 3600) {
     unsigned long minutes = seconds / 60;
     unsigned long remainingSeconds = seconds % 60;
     if (remainingSeconds == 0) {
-      return String(minutes) + "m";
+      snprintf(out, size, "%lum", minutes);
     } else {
-      return String(minutes) + "m " + String(remainingSeconds) + "s";
+      snprintf(out, size, "%lum %lus", minutes, remainingSeconds);
     }
   } else {
     unsigned long hours = seconds / 3600;
     unsigned long minutes = (seconds % 3600) / 60;
     if (minutes == 0) {
-      return String(hours) + "h";
+      snprintf(out, size, "%luh", hours);
     } else {
-      return String(hours) + "h " + String(minutes) + "m";
+      snprintf(out, size, "%luh %lum", hours, minutes);
     }
   }
+  return out;
 }
 
 String TelegramService::getCurrentTime() const {
@@ -289,91 +554,160 @@ String TelegramService::getCurrentTime() const {
   return timeStr;
 }
 
-String TelegramService::formatMillisToTime(unsigned long millisTime) const {
+const char* TelegramService::formatMillisToTime(unsigned long millisTime, char* out, size_t size) const {
   // Convert millis to relative time from boot
   unsigned long seconds = millisTime / 1000;
   unsigned long hours = (seconds / 3600) % 24;
   unsigned long minutes = (seconds / 60) % 60;
   unsigned long secs = seconds % 60;
   
-  String timeStr = "";
-  if (hours < 10) timeStr += "0";
-  timeStr += String(hours) + ":";
-  if (minutes < 10) timeStr += "0";
-  timeStr += String(minutes) + ":";
-  if (secs < 10) timeStr += "0";
-  timeStr += String(secs);
-  
-  return timeStr + " (uptime)";
+  snprintf(out, size, "%02lu:%02lu:%02lu (uptime)", hours, minutes, secs);
+  return out;
 }
 
-String TelegramService::convertMillisToRealTime(unsigned long millisTime) const {
+const char* TelegramService::convertMillisToRealTime(unsigned long millisTime, char* out, size_t size) const {
   // Try to get current NTP time
   String currentTimeStr = NTPService::getCurrentDateTime();
   
   // If NTP is working, calculate the real time
   if (!currentTimeStr.endsWith("(uptime)")) {
     // NTP is working, calculate the real time for the millis timestamp
-    unsigned long currentMillis = millis();
-    unsigned long timeDiff = currentMillis - millisTime;
+    unsigned long timeDiff = millis() - millisTime;
     
     // Extract time part from DD/MM/YYYY HH:MM:SS format
-    int spaceIndex = currentTimeStr.indexOf(' ');
-    if (spaceIndex > 0) {
-      String timePart = currentTimeStr.substring(spaceIndex + 1);
-      
-      // Parse HH:MM:SS
-      int colon1 = timePart.indexOf(':');
-      int colon2 = timePart.indexOf(':', colon1 + 1);
-      
-      if (colon1 > 0 && colon2 > 0) {
-        int hours = timePart.substring(0, colon1).toInt();
-        int minutes = timePart.substring(colon1 + 1, colon2).toInt();
-        int seconds = timePart.substring(colon2 + 1).toInt();
-        
-        // Convert to total seconds since midnight
-        unsigned long currentSeconds = hours * 3600 + minutes * 60 + seconds;
-        
-        // Subtract the time difference
-        unsigned long targetSeconds = currentSeconds - (timeDiff / 1000);
-        
-        // Handle day rollover
-        if (targetSeconds < 0) {
-          targetSeconds += 86400; // Add 24 hours
-        }
-        
-        // Convert back to HH:MM:SS
-        int targetHours = (targetSeconds / 3600) % 24;
-        int targetMinutes = (targetSeconds / 60) % 60;
-        int targetSecs = targetSeconds % 60;
-        
-        String timeStr = "";
-        if (targetHours < 10) timeStr += "0";
-        timeStr += String(targetHours) + ":";
-        if (targetMinutes < 10) timeStr += "0";
-        timeStr += String(targetMinutes) + ":";
-        if (targetSecs < 10) timeStr += "0";
-        timeStr += String(targetSecs);
-        
-        return timeStr;
+    int hours, minutes, seconds;
+    const char* timePart = strchr(currentTimeStr.c_str(), ' ');
+    if (timePart && sscanf(timePart + 1, "%d:%d:%d", &hours, &minutes, &seconds) == 3) {
+      // Convert to total seconds since midnight, subtract the elapsed time
+      // and handle day rollover
+      long targetSeconds = (long)(hours * 3600 + minutes * 60 + seconds) - (long)(timeDiff / 1000);
+      targetSeconds %= 86400;
+      if (targetSeconds < 0) {
+        targetSeconds += 86400;
       }
+      
+      snprintf(out, size, "%02ld:%02ld:%02ld",
+               targetSeconds / 3600, (targetSeconds / 60) % 60, targetSeconds % 60);
+      return out;
     }
   }
   
   // Fallback to uptime format
-  return formatMillisToTime(millisTime);
+  return formatMillisToTime(millisTime, out, size);
 }
 
-bool TelegramService::sendMessage(const String& message, int targetIndex, bool isRecovery) {
+size_t TelegramService::appendf(char* dst, size_t size, size_t pos, const char* format, ...) {
+  if (pos + 1 >= size) {
+    return pos;
+  }
+  
+  va_list args;
+  va_start(args, format);
+  int written = vsnprintf(dst + pos, size - pos, format, args);
+  va_end(args);
+  
+  if (written < 0) {
+    dst[pos] = '\0';
+    return pos;
+  }
+  
+  // Clamp on truncation so callers can keep appending safely
+  pos += (size_t)written;
+  return pos < size ? pos : size - 1;
+}
+
+size_t TelegramService::appendJsonEscaped(char* dst, size_t size, size_t pos, const char* src) {
+  size_t start = pos;
+  pos = appendf(dst, size, pos, "%s", src);
+  return start + escapeJsonInPlace(dst + start, pos - start, size - start - 1);
+}
+
+size_t TelegramService::escapeJsonInPlace(char* text, size_t length, size_t capacity) {
+  // First pass: find how much of the text fits once escaped
+  size_t escapedLength = 0;
+  size_t fitLength = 0;
+  for (size_t i = 0; i < length; i++) {
+    unsigned char c = (unsigned char)text[i];
+    size_t cost = 1;
+    if (c == '"' || c == '\\' || c == '\n' || c == '\r' || c == '\t') {
+      cost = 2;
+    } else if (c < 0x20) {
+      cost = 6; // \u00XX
+    }
+    if (escapedLength + cost > capacity) break;
+    escapedLength += cost;
+    fitLength = i + 1;
+  }
+  
+  // Never cut a UTF-8 sequence (emojis) in half, Telegram rejects invalid text
+  if (fitLength < length) {
+    while (fitLength > 0 && ((unsigned char)text[fitLength] & 0xC0) == 0x80) {
+      fitLength--;
+      escapedLength--;
+    }
+  }
+  
+  // Second pass: expand backwards so nothing is overwritten before it is read
+  size_t out = escapedLength;
+  text[out] = '\0';
+  for (size_t i = fitLength; i-- > 0;) {
+    unsigned char c = (unsigned char)text[i];
+    switch (c) {
+      case '"':  text[--out] = '"';  text[--out] = '\\'; break;
+      case '\\': text[--out] = '\\'; text[--out] = '\\'; break;
+      case '\n': text[--out] = 'n';  text[--out] = '\\'; break;
+      case '\r': text[--out] = 'r';  text[--out] = '\\'; break;
+      case '\t': text[--out] = 't';  text[--out] = '\\'; break;
+      default:
+        if (c < 0x20) {
+          static const char hex[] = "0123456789abcdef";
+          text[--out] = hex[c & 0x0F];
+          text[--out] = hex[c >> 4];
+          text[--out] = '0';
+          text[--out] = '0';
+          text[--out] = 'u';
+          text[--out] = '\\';
+        } else {
+          text[--out] = (char)c;
+        }
+        break;
+    }
+  }
+  
+  return escapedLength;
+}
+
+size_t TelegramService::beginPayload(int targetIndex) {
+  size_t pos = appendf(payloadBuffer, PAYLOAD_BUFFER_SIZE, 0, "{\"chat_id\":\"");
+  pos = appendJsonEscaped(payloadBuffer, PAYLOAD_BUFFER_SIZE, pos, chatId.c_str());
+  pos = appendf(payloadBuffer, PAYLOAD_BUFFER_SIZE, pos, "\",\"parse_mode\":\"HTML\",");
+  
+  // Add reply_to_message_id if we have an active thread for this target
+  if (targetIndex >= 0 && targetIndex < MAX_TARGETS && isThreadActive[targetIndex] && lastMessageIds[targetIndex] > 0) {
+    pos = appendf(payloadBuffer, PAYLOAD_BUFFER_SIZE, pos, "\"reply_to_message_id\":%u,", lastMessageIds[targetIndex]);
+    Serial_printf("[TELEGRAM] Sending reply to message %d for target %d\n", lastMessageIds[targetIndex], targetIndex);
+  }
+  
+  return appendf(payloadBuffer, PAYLOAD_BUFFER_SIZE, pos, "\"text\":\"");
+}
+
+size_t TelegramService::finishPayload(size_t textStart, size_t textLength) {
+  // Keep room for the closing quote, brace and terminator
+  size_t capacity = PAYLOAD_BUFFER_SIZE - textStart - 3;
+  size_t escapedLength = escapeJsonInPlace(payloadBuffer + textStart, textLength, capacity);
+  return appendf(payloadBuffer, PAYLOAD_BUFFER_SIZE, textStart + escapedLength, "\"}");
+}
+
+bool TelegramService::sendPayload(size_t length, int targetIndex, bool isRecovery) {
   if (!enabled) {
     return false;
   }
 
-  // Use SSL mutex to prevent memory allocation conflicts
-  SSLLock sslLock(3000); // 3 second timeout
+  // Alerts go ahead of probes waiting for a TLS session
+  TlsSlot tlsSlot(TlsBudget::PRIORITY_ALERT, 3000); // 3 second timeout
   
-  if (!sslLock.isLocked()) {
-    Serial_println("[TELEGRAM] ERROR: Failed to acquire SSL lock!");
+  if (!tlsSlot.isHeld()) {
+    Serial_println("[TELEGRAM] ERROR: No TLS session slot!");
     return false;
   }
 
@@ -383,10 +717,13 @@ bool TelegramService::sendMessage(const String& message, int targetIndex, bool i
     return false;
   }
 
+  WiFiClientSecure client;
+  client.setInsecure();
   HTTPClient http;
-  String url = "https://api.telegram.org/bot" + botToken + "/sendMessage";
+  char url[160];
+  snprintf(url, sizeof(url), "https://api.telegram.org/bot%s/sendMessage", botToken.c_str());
   
-  if (!http.begin(url)) {
+  if (!DnsCache::connect(client, TELEGRAM_API_HOST, 443) || !http.begin(client, url)) {
     Serial_println("[TELEGRAM] ERROR: Failed to begin HTTP request");
     return false;
   }
@@ -394,33 +731,11 @@ bool TelegramService::sendMessage(const String& message, int targetIndex, bool i
   http.addHeader("Content-Type", "application/json");
   http.setTimeout(5000); // 5 second timeout
   
-  // Create JSON payload with memory management
-  DynamicJsonDocument doc(1024);
-  doc["chat_id"] = chatId;
-  doc["text"] = message;
-  doc["parse_mode"] = "HTML";
-  
-  // Add reply_to_message_id if we have an active thread for this target
-  if (targetIndex >= 0 && targetIndex < 6 && isThreadActive[targetIndex] && lastMessageIds[targetIndex] > 0) {
-    doc["reply_to_message_id"] = lastMessageIds[targetIndex];
-    Serial_printf("[TELEGRAM] Sending reply to message %d for target %d\n", lastMessageIds[targetIndex], targetIndex);
-  }
-  
-  String payload;
-  serializeJson(doc, payload);
-  
-  // Clear document to free memory
-  doc.clear();
-  
-  Serial_printf("[TELEGRAM] Sending message (heap: %d bytes)\n", ESP.getFreeHeap());
+  Serial_printf("[TELEGRAM] Sending message (%u bytes, heap: %d bytes)\n", (unsigned)length, ESP.getFreeHeap());
   
-  int httpResponseCode = http.POST(payload);
+  int httpResponseCode = http.POST((uint8_t*)payloadBuffer, length);
   http.end();
   
-  // Force cleanup of payload
-  payload = "";
-  payload.reserve(0);
-  
   if (httpResponseCode > 0) {
     if (httpResponseCode == 200) {
       Serial_println("[TELEGRAM] Message sent successfully");
@@ -431,7 +746,7 @@ bool TelegramService::sendMessage(const String& message, int targetIndex, bool i
       uint32_t realMessageId = 0; // Will be implemented later
       
       // Update thread management for this target
-      if (targetIndex >= 0 && targetIndex < 6) {
+      if (targetIndex >= 0 && targetIndex < MAX_TARGETS) {
         if (isRecovery) {
           // Recovery ends the thread
           isThreadActive[targetIndex] = false;
@@ -460,24 +775,6 @@ bool TelegramService::sendMessage(const String& message, int targetIndex, bool i
   return false;
 }
 
-bool TelegramService::isTimeForAlert(int targetIndex, bool isRecovery) const {
-  if (targetIndex < 0 || targetIndex >= 6 || !alerts[targetIndex]) {
-    return false;
-  }
-
-  unsigned long now = millis();
-  unsigned long lastAlertTime = alerts[targetIndex]->getLastAlertTime();
-  unsigned long cooldown = isRecovery ? ALERT_RECOVERY_COOLDOWN_MS : ALERT_COOLDOWN_MS;
-  
-  // If lastAlertTime is 0, it means no alert has been sent yet - allow immediate sending
-  if (lastAlertTime == 0) {
-    return true;
-  }
-  
-  unsigned long timeSinceLastAlert = now - lastAlertTime;
-  return timeSinceLastAlert >= cooldown;
-}
-
 bool TelegramService::isHealthCheckHealthy(const String& response) const {
   // Simple health check - look for common success indicators
   return response.indexOf("200") != -1 || 
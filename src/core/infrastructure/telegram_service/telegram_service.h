@@ -1,25 +1,35 @@
 #pragma once
-#include "core/domain/alert/alert.h"
-#include "core/infrastructure/ssl_mutex_manager/ssl_mutex_manager.h"
+#include "core/infrastructure/notifier/notifier.h"
+#include "core/domain/status_snapshot/status_snapshot.h"
+#include "core/infrastructure/tls_budget/tls_budget.h"
 #include "core/infrastructure/ntp_service/ntp_service.h"
 #include <Arduino.h>
 
-class TelegramService {
+class TelegramService : public Notifier {
 private:
   String botToken;
   String chatId;
   bool enabled;
   bool sendingMessage;
-  Alert* alerts[6]; // Array of alert objects
   
   // Reply thread management
-  uint32_t lastMessageIds[6]; // message_id por target para reply
-  bool isThreadActive[6];     // thread ativa por target
+  uint32_t lastMessageIds[MAX_TARGETS]; // message_id por target para reply
+  bool isThreadActive[MAX_TARGETS];     // thread ativa por target
   
-  // Configuration
-  static const uint8_t MAX_FAILURES_BEFORE_ALERT = 3;
-  static const unsigned long ALERT_COOLDOWN_MS = 300000; // 5 minutes
-  static const unsigned long ALERT_RECOVERY_COOLDOWN_MS = 60000; // 1 minute
+  // Message rendering: templates are formatted straight into the JSON payload
+  // and escaped in place, so a send needs no heap allocations for the text
+  static const size_t PAYLOAD_BUFFER_SIZE = 2048;
+  char payloadBuffer[PAYLOAD_BUFFER_SIZE];
+  
+  // Chat commands (/status, /target <name>) via getUpdates long polling.
+  // The long-poll timeout bounds how long a fresh alert can wait behind a poll.
+  static const uint8_t LONG_POLL_TIMEOUT_S = 2;
+  static const uint8_t MAX_UPDATES_PER_POLL = 3;
+  static const size_t COMMAND_TEXT_SIZE = 64;
+  bool commandsEnabled;
+  unsigned long pollIntervalMs;
+  unsigned long lastPollTime;
+  int32_t nextUpdateId;
   
 public:
   TelegramService();
@@ -27,35 +37,52 @@ public:
   
   // Initialization
   bool initialize(const String& botToken, const String& chatId, bool enabled = true);
+  void setCommandPolling(bool enabled, unsigned long intervalMs);
+  
+  // Notifier interface (called from the notification task)
+  const char* getName() const override { return "telegram"; }
+  bool isActive() const override;
+  bool send(const NotificationEvent& event) override;
+  RetryPolicy getRetryPolicy() const override { return {4, 5000, 60000}; }
+  void poll() override;
   
-  // Alert management
-  void updateTargetStatus(int targetIndex, Status newStatus, uint16_t latency, const String& targetName);
-  void sendAlert(int targetIndex, const String& targetName, Status status, uint16_t latency);
-  void sendRecoveryAlert(int targetIndex, const String& targetName, uint16_t latency);
+  // Direct send, used once at startup before the dispatcher runs
   void sendTestMessage(const String* targetNames, int targetCount);
   
   // Status
-  bool isActive() const;
   bool isSendingMessage() const { return sendingMessage; }
-  bool hasActiveAlerts() const;
-  
-  // Alert management
-  int getFailureCount(int targetIndex) const;
   
 private:
-  // Message formatting
-  String formatAlertMessage(const String& targetName, Status status, uint16_t latency, bool isRecovery = false, unsigned long totalDowntime = 0);
-  String formatRecoveryMessage(const String& targetName, uint16_t latency, unsigned long totalDowntime, 
+  // Message formatting (render into dst, return number of bytes written)
+  size_t formatAlertMessage(char* dst, size_t size, const char* targetName, Status status, uint16_t latency,
+                            bool isRecovery = false, unsigned long totalDowntime = 0);
+  size_t formatRecoveryMessage(char* dst, size_t size, const char* targetName, uint16_t latency, unsigned long totalDowntime,
                                unsigned long firstFailureTime, unsigned long alertStartTime);
-  String formatTime(unsigned long seconds) const;
-  String formatMillisToTime(unsigned long millisTime) const;
-  String convertMillisToRealTime(unsigned long millisTime) const;
+  size_t formatFlapMessage(char* dst, size_t size, const NotificationEvent& event);
+  size_t formatLatencyMessage(char* dst, size_t size, const NotificationEvent& event);
+  size_t formatTestMessage(char* dst, size_t size, const String* targetNames, int targetCount);
+  const char* formatTime(unsigned long seconds, char* out, size_t size) const;
+  const char* formatMillisToTime(unsigned long millisTime, char* out, size_t size) const;
+  const char* convertMillisToRealTime(unsigned long millisTime, char* out, size_t size) const;
   String getCurrentTime() const;
   
+  // Payload building
+  size_t beginPayload(int targetIndex);
+  size_t finishPayload(size_t textStart, size_t textLength);
+  static size_t appendf(char* dst, size_t size, size_t pos, const char* format, ...);
+  static size_t appendJsonEscaped(char* dst, size_t size, size_t pos, const char* src);
+  static size_t escapeJsonInPlace(char* text, size_t length, size_t capacity);
+  
+  // Chat commands
+  int fetchCommands(char commands[][COMMAND_TEXT_SIZE], int maxCommands);
+  void handleCommand(const char* text);
+  size_t formatStatusReply(char* dst, size_t size, const StatusSnapshot& snap);
+  size_t formatTargetReply(char* dst, size_t size, const StatusSnapshot& snap, const char* query);
+  size_t formatHelpReply(char* dst, size_t size);
+  
   // HTTP communication
-  bool sendMessage(const String& message, int targetIndex = -1, bool isRecovery = false);
+  bool sendPayload(size_t length, int targetIndex = -1, bool isRecovery = false);
   
-  // Alert logic
-  bool isTimeForAlert(int targetIndex, bool isRecovery = false) const;
+  // Response checks
   bool isHealthCheckHealthy(const String& response) const;
-};
+};
\ No newline at end of file
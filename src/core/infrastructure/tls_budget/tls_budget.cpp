@@ -0,0 +1,286 @@
+#include "core/infrastructure/tls_budget/tls_budget.h"
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
+#include "core/infrastructure/logger/logger.h"
+
+// Static member definitions
+TlsBudget::Waiter TlsBudget::waiters[MAX_WAITERS];
+uint8_t TlsBudget::inUse = 0;
+uint8_t TlsBudget::peakInUse = 0;
+uint8_t TlsBudget::maxSessions = 2;
+uint32_t TlsBudget::sessionHeap = 45000;
+uint32_t TlsBudget::nextTicket = 0;
+TlsBudget::Stats TlsBudget::stats[PRIORITY_COUNT];
+portMUX_TYPE TlsBudget::lock = portMUX_INITIALIZER_UNLOCKED;
+bool TlsBudget::initialized = false;
+
+static const char* PRIORITY_NAMES[TlsBudget::PRIORITY_COUNT] = {"probe", "command", "alert"};
+
+bool TlsBudget::initialize(uint8_t sessions, uint32_t heapPerSession) {
+  if (initialized) {
+    Serial_println("[TLS] Already initialized");
+    return true;
+  }
+
+  Serial_println("[TLS] Initializing TLS session budget...");
+
+  maxSessions = sessions > 0 ? sessions : 1;
+  sessionHeap = heapPerSession > 0 ? heapPerSession : 45000;
+
+  for (int i = 0; i < MAX_WAITERS; i++) {
+    Waiter& waiter = waiters[i];
+    waiter.wake = RtosAlloc::createBinarySemaphore();
+    waiter.waiting = false;
+    waiter.granted = false;
+    if (!waiter.wake) {
+      Serial_println("[TLS] ERROR: Failed to create waiter semaphore!");
+      cleanup();
+      return false;
+    }
+  }
+
+  resetStatistics();
+  inUse = 0;
+
+  initialized = true;
+  Serial_printf("[TLS] Up to %u concurrent session(s), %lu bytes of heap each\n", maxSessions,
+                (unsigned long)sessionHeap);
+  return true;
+}
+
+void TlsBudget::cleanup() {
+  if (inUse > 0) {
+    Serial_printf("[TLS] WARNING: %u session(s) still open during cleanup!\n", inUse);
+  }
+
+  for (int i = 0; i < MAX_WAITERS; i++) {
+    if (waiters[i].wake) {
+      vSemaphoreDelete(waiters[i].wake);
+      waiters[i].wake = nullptr;
+    }
+  }
+
+  initialized = false;
+  inUse = 0;
+}
+
+uint8_t TlsBudget::computeHeadroom() {
+  // Sessions already open hold their buffers, so this counts new ones only
+  uint32_t freeHeap = ESP.getFreeHeap();
+  uint32_t largestBlock = ESP.getMaxAllocHeap();
+  if (largestBlock < MIN_BLOCK || freeHeap <= HEAP_RESERVE) return 0;
+
+  uint32_t sessions = (freeHeap - HEAP_RESERVE) / sessionHeap;
+  return sessions > 255 ? 255 : (uint8_t)sessions;
+}
+
+bool TlsBudget::admits(uint8_t headroom) {
+  // With nothing open, waiting can't make the heap any better: allow one
+  return inUse < maxSessions && (headroom > 0 || inUse == 0);
+}
+
+uint8_t TlsBudget::getBudget() {
+  uint8_t headroom = computeHeadroom();
+  if (inUse == 0 && headroom == 0) headroom = 1;
+  uint32_t budget = (uint32_t)inUse + headroom;
+  return budget > maxSessions ? maxSessions : (uint8_t)budget;
+}
+
+int TlsBudget::nextWaiter() {
+  int best = -1;
+  for (int i = 0; i < MAX_WAITERS; i++) {
+    const Waiter& waiter = waiters[i];
+    if (!waiter.waiting || waiter.granted) continue;
+    if (best < 0 || waiter.priority > waiters[best].priority ||
+        (waiter.priority == waiters[best].priority && (int32_t)(waiter.ticket - waiters[best].ticket) < 0)) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+bool TlsBudget::hasWaiterAtOrAbove(uint8_t priority) {
+  for (int i = 0; i < MAX_WAITERS; i++) {
+    if (waiters[i].waiting && !waiters[i].granted && waiters[i].priority >= priority) return true;
+  }
+  return false;
+}
+
+uint8_t TlsBudget::grantWaiters(uint8_t headroom, int* granted) {
+  // Called with the lock held; the caller wakes the granted waiters after
+  uint8_t count = 0;
+  while (admits(headroom)) {
+    int next = nextWaiter();
+    if (next < 0) break;
+    waiters[next].granted = true;
+    inUse++;
+    if (headroom > 0) headroom--;
+    granted[count++] = next;
+  }
+  if (inUse > peakInUse) peakInUse = inUse;
+  return count;
+}
+
+bool TlsBudget::acquire(Priority priority, uint32_t timeout_ms) {
+  if (!initialized) {
+    Serial_println("[TLS] ERROR: Not initialized!");
+    return false;
+  }
+
+  uint32_t start = millis();
+  uint8_t headroom = computeHeadroom();
+  bool granted = false;
+  int slot = -1;
+
+  portENTER_CRITICAL(&lock);
+  // Anyone already queued at this priority or above goes first
+  if (admits(headroom) && !hasWaiterAtOrAbove(priority)) {
+    inUse++;
+    if (inUse > peakInUse) peakInUse = inUse;
+    granted = true;
+  } else if (timeout_ms > 0) {
+    for (int i = 0; i < MAX_WAITERS; i++) {
+      Waiter& waiter = waiters[i];
+      if (waiter.waiting) continue;
+      waiter.waiting = true;
+      waiter.granted = false;
+      waiter.priority = priority;
+      waiter.ticket = nextTicket++;
+      slot = i;
+      break;
+    }
+  }
+  portEXIT_CRITICAL(&lock);
+
+  if (slot >= 0) {
+    Waiter& waiter = waiters[slot];
+    while (true) {
+      uint32_t elapsed = millis() - start;
+      if (elapsed >= timeout_ms) break;
+      uint32_t step = timeout_ms - elapsed;
+      if (step > RECHECK_MS) step = RECHECK_MS;
+      xSemaphoreTake(waiter.wake, pdMS_TO_TICKS(step));
+
+      // Woken by a release, or time to see whether the heap freed up
+      headroom = computeHeadroom();
+      portENTER_CRITICAL(&lock);
+      if (!waiter.granted && nextWaiter() == slot && admits(headroom)) {
+        waiter.granted = true;
+        inUse++;
+        if (inUse > peakInUse) peakInUse = inUse;
+      }
+      granted = waiter.granted;
+      portEXIT_CRITICAL(&lock);
+      if (granted) break;
+    }
+
+    // A release may have granted the slot right at the deadline
+    portENTER_CRITICAL(&lock);
+    granted = waiter.granted;
+    waiter.waiting = false;
+    waiter.granted = false;
+    portEXIT_CRITICAL(&lock);
+  } else if (!granted && timeout_ms > 0) {
+    Serial_println("[TLS] WARNING: Too many waiters, request rejected");
+  }
+
+  recordWait(priority, millis() - start, granted);
+  if (!granted && timeout_ms > 0) {
+    Serial_printf("[TLS] No session slot for %s after %lu ms (%u open)\n", PRIORITY_NAMES[priority],
+                  (unsigned long)(millis() - start), inUse);
+  }
+  return granted;
+}
+
+void TlsBudget::release() {
+  if (!initialized) return;
+
+  // The session's buffers are already freed, so this headroom includes them
+  uint8_t headroom = computeHeadroom();
+  int woken[MAX_WAITERS];
+  bool underflow = false;
+
+  portENTER_CRITICAL(&lock);
+  if (inUse > 0) {
+    inUse--;
+  } else {
+    underflow = true;
+  }
+  uint8_t count = grantWaiters(headroom, woken);
+  portEXIT_CRITICAL(&lock);
+
+  for (uint8_t i = 0; i < count; i++) {
+    xSemaphoreGive(waiters[woken[i]].wake);
+  }
+  if (underflow) {
+    Serial_println("[TLS] WARNING: Release without an open session!");
+  }
+}
+
+void TlsBudget::recordWait(Priority priority, uint32_t waitMs, bool acquired) {
+  portENTER_CRITICAL(&lock);
+  Stats& s = stats[priority];
+  if (acquired) {
+    s.acquired++;
+    s.totalWaitMs += waitMs;
+    if (waitMs > s.maxWaitMs) s.maxWaitMs = waitMs;
+  } else {
+    s.timeouts++;
+  }
+  portEXIT_CRITICAL(&lock);
+}
+
+void TlsBudget::getStatistics(uint32_t& total_locks_out,
+                              uint32_t& avg_wait_time_ms_out,
+                              uint32_t& max_wait_time_ms_out) {
+  uint32_t total = 0;
+  uint32_t totalWait = 0;
+  uint32_t maxWait = 0;
+  for (int i = 0; i < PRIORITY_COUNT; i++) {
+    total += stats[i].acquired;
+    totalWait += stats[i].totalWaitMs;
+    if (stats[i].maxWaitMs > maxWait) maxWait = stats[i].maxWaitMs;
+  }
+
+  total_locks_out = total;
+  avg_wait_time_ms_out = total > 0 ? totalWait / total : 0;
+  max_wait_time_ms_out = maxWait;
+}
+
+bool TlsBudget::getPriorityStats(Priority priority, Stats& out) {
+  if (priority < 0 || priority >= PRIORITY_COUNT) return false;
+  out = stats[priority];
+  return true;
+}
+
+void TlsBudget::resetStatistics() {
+  memset(stats, 0, sizeof(stats));
+  peakInUse = inUse;
+}
+
+void TlsBudget::printStatistics() {
+  Serial_println("\n=== TLS SESSION BUDGET ===");
+  Serial_printf("Open: %u | Budget now: %u | Peak: %u | Max: %u\n", inUse, getBudget(), peakInUse, maxSessions);
+  for (int i = PRIORITY_COUNT - 1; i >= 0; i--) {
+    const Stats& s = stats[i];
+    Serial_printf("%-8s acquired=%lu timeouts=%lu avg wait=%lums max wait=%lums\n", PRIORITY_NAMES[i],
+                  (unsigned long)s.acquired, (unsigned long)s.timeouts,
+                  (unsigned long)(s.acquired > 0 ? s.totalWaitMs / s.acquired : 0), (unsigned long)s.maxWaitMs);
+  }
+  Serial_println("==========================\n");
+}
+
+// TlsSlot RAII wrapper implementation
+TlsSlot::TlsSlot(TlsBudget::Priority priority, uint32_t timeout_ms) : held(false) {
+  held = TlsBudget::acquire(priority, timeout_ms);
+}
+
+TlsSlot::~TlsSlot() {
+  release();
+}
+
+void TlsSlot::release() {
+  if (held) {
+    TlsBudget::release();
+    held = false;
+  }
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include <Arduino.h>
+
+/**
+ * @brief TLS Budget - Bounds concurrent TLS sessions by what the heap can hold
+ *
+ * A TLS session costs tens of KB of heap for mbedTLS record buffers. Instead
+ * of one global lock, every session takes a slot from a budget recomputed
+ * at acquisition time from free heap and the largest free block (capped by
+ * TLS_MAX_SESSIONS, never below one). When no slot is free, callers wait in
+ * priority order (alerts, then chat commands, then probes; FIFO within a
+ * class), so an alert never queues behind a batch of probe handshakes.
+ */
+class TlsBudget {
+public:
+  enum Priority {
+    PRIORITY_PROBE = 0,
+    PRIORITY_COMMAND,
+    PRIORITY_ALERT,
+    PRIORITY_COUNT
+  };
+
+  static const uint8_t MAX_WAITERS = 8;
+
+  // Per-priority wait statistics
+  struct Stats {
+    uint32_t acquired;
+    uint32_t timeouts;
+    uint32_t totalWaitMs;
+    uint32_t maxWaitMs;
+  };
+
+private:
+  struct Waiter {
+    SemaphoreHandle_t wake;   // one per slot, given when the session is granted
+    uint32_t ticket;          // FIFO order within a priority
+    uint8_t priority;
+    bool waiting;
+    bool granted;
+  };
+
+  static Waiter waiters[MAX_WAITERS];
+  static uint8_t inUse;
+  static uint8_t peakInUse;
+  static uint8_t maxSessions;
+  static uint32_t sessionHeap;
+  static uint32_t nextTicket;
+  static Stats stats[PRIORITY_COUNT];
+  static portMUX_TYPE lock;
+  static bool initialized;
+
+  // Left for the rest of the system after the last session
+  static const uint32_t HEAP_RESERVE = 20000;
+  // A record buffer (16KB) plus overhead must fit in one block
+  static const uint32_t MIN_BLOCK = 20000;
+  // Waiters re-check the heap this often, memory can free up without a release
+  static const uint32_t RECHECK_MS = 250;
+
+public:
+  /**
+   * @brief Initialize the budget
+   * @param sessions Upper bound on concurrent TLS sessions
+   * @param heapPerSession Heap one session is expected to take (bytes)
+   * @return true if successful, false otherwise
+   */
+  static bool initialize(uint8_t sessions, uint32_t heapPerSession);
+
+  /**
+   * @brief Cleanup the budget
+   */
+  static void cleanup();
+
+  /**
+   * @brief Take a TLS session slot
+   * @param priority Queue position while the budget is exhausted
+   * @param timeout_ms Maximum time to wait (0 = try once)
+   * @return true if a slot was granted, false on timeout
+   */
+  static bool acquire(Priority priority, uint32_t timeout_ms);
+
+  /**
+   * @brief Return a slot taken with acquire()
+   */
+  static void release();
+
+  /**
+   * @brief Sessions open right now / sessions the heap allows right now
+   */
+  static uint8_t getInUse() { return inUse; }
+  static uint8_t getBudget();
+
+  /**
+   * @brief Get statistics over all priorities
+   * @param total_locks_out Total number of slots granted
+   * @param avg_wait_time_ms_out Average wait time in milliseconds
+   * @param max_wait_time_ms_out Maximum wait time ever recorded
+   */
+  static void getStatistics(uint32_t& total_locks_out,
+                            uint32_t& avg_wait_time_ms_out,
+                            uint32_t& max_wait_time_ms_out);
+  static bool getPriorityStats(Priority priority, Stats& out);
+  static void resetStatistics();
+  static void printStatistics();
+
+  static bool isInitialized() { return initialized; }
+
+private:
+  static uint8_t computeHeadroom();
+  static bool admits(uint8_t headroom);
+  static int nextWaiter();
+  static bool hasWaiterAtOrAbove(uint8_t priority);
+  static uint8_t grantWaiters(uint8_t headroom, int* granted);
+  static void recordWait(Priority priority, uint32_t waitMs, bool acquired);
+};
+
+// RAII wrapper, holds a TLS session slot for its scope
+class TlsSlot {
+private:
+  bool held;
+
+public:
+  /**
+   * @brief Constructor - waits for a slot
+   * @param priority Queue position while the budget is exhausted
+   * @param timeout_ms Maximum time to wait for a slot
+   */
+  TlsSlot(TlsBudget::Priority priority, uint32_t timeout_ms);
+
+  /**
+   * @brief Destructor - returns the slot
+   */
+  ~TlsSlot();
+
+  /**
+   * @brief Check if a slot was granted
+   */
+  bool isHeld() const { return held; }
+
+  /**
+   * @brief Return the slot early (optional)
+   */
+  void release();
+
+  // Disable copy constructor and assignment
+  TlsSlot(const TlsSlot&) = delete;
+  TlsSlot& operator=(const TlsSlot&) = delete;
+};
@@ -0,0 +1,91 @@
+#include "core/infrastructure/webhook_notifier/webhook_notifier.h"
+#include "core/infrastructure/tls_budget/tls_budget.h"
+#include "core/infrastructure/memory_manager/memory_manager.h"
+#include "core/infrastructure/logger/logger.h"
+#include <HTTPClient.h>
+
+WebhookNotifier::WebhookNotifier() : enabled(false) {
+}
+
+bool WebhookNotifier::initialize(const String& url, bool enabled) {
+  if (!enabled) {
+    this->enabled = false;
+    return true;
+  }
+  
+  if (!url.startsWith("http://") && !url.startsWith("https://")) {
+    Serial_println("[WEBHOOK] ERROR: Invalid webhook URL");
+    this->enabled = false;
+    return false;
+  }
+  
+  this->url = url;
+  this->enabled = true;
+  
+  Serial_printf("[WEBHOOK] Service initialized: %s\n", url.c_str());
+  return true;
+}
+
+size_t WebhookNotifier::formatPayload(const NotificationEvent& event) {
+  // Target names come from config.env, only quotes and backslashes need escaping
+  char name[sizeof(event.targetName) * 2];
+  size_t n = 0;
+  for (const char* p = event.targetName; *p && n < sizeof(name) - 2; p++) {
+    if (*p == '"' || *p == '\\') name[n++] = '\\';
+    if ((unsigned char)*p >= 0x20) name[n++] = *p;
+  }
+  name[n] = '\0';
+  
+  int written = snprintf(payloadBuffer, PAYLOAD_BUFFER_SIZE,
+                         "{\"event\":\"%s\",\"target\":\"%s\",\"index\":%d,\"status\":\"%s\","
+                         "\"latency_ms\":%u,\"slo_ms\":%u,\"downtime_s\":%lu,\"state_changes\":%u,\"change_pct\":%u,\"dependents\":%u,"
+                         "\"uptime_ms\":%lu}",
+                         getNotificationTypeName(event.type), name, (int)event.targetIndex,
+                         getStatusName(event.status), (unsigned)event.latency, (unsigned)event.thresholdMs,
+                         (unsigned long)event.downtimeSeconds, (unsigned)event.stateChanges,
+                         (unsigned)event.changePercent, (unsigned)event.dependentCount,
+                         (unsigned long)event.createdAt);
+  
+  if (written < 0) return 0;
+  return (size_t)written < PAYLOAD_BUFFER_SIZE ? (size_t)written : PAYLOAD_BUFFER_SIZE - 1;
+}
+
+bool WebhookNotifier::send(const NotificationEvent& event) {
+  if (!enabled) {
+    return false;
+  }
+  
+  if (MemoryManager::getInstance().isMemoryLow()) {
+    Serial_println("[WEBHOOK] WARNING: Low memory, deferring event");
+    return false;
+  }
+  
+  size_t length = formatPayload(event);
+  
+  // Same rule as the Telegram sender: alerts go ahead of probes
+  TlsSlot tlsSlot(TlsBudget::PRIORITY_ALERT, 3000);
+  if (!tlsSlot.isHeld()) {
+    Serial_println("[WEBHOOK] ERROR: No TLS session slot!");
+    return false;
+  }
+  
+  HTTPClient http;
+  if (!http.begin(url)) {
+    Serial_println("[WEBHOOK] ERROR: Failed to begin HTTP request");
+    return false;
+  }
+  
+  http.addHeader("Content-Type", "application/json");
+  http.setTimeout(5000);
+  
+  int httpResponseCode = http.POST((uint8_t*)payloadBuffer, length);
+  http.end();
+  
+  if (httpResponseCode >= 200 && httpResponseCode < 300) {
+    Serial_printf("[WEBHOOK] Event delivered for %s (HTTP %d)\n", event.targetName, httpResponseCode);
+    return true;
+  }
+  
+  Serial_printf("[WEBHOOK] Delivery failed for %s (HTTP %d)\n", event.targetName, httpResponseCode);
+  return false;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "core/infrastructure/notifier/notifier.h"
+#include <Arduino.h>
+
+/**
+ * @brief Webhook Notifier - POSTs alert events as JSON to a configured URL
+ */
+class WebhookNotifier : public Notifier {
+private:
+  String url;
+  bool enabled;
+  
+  static const size_t PAYLOAD_BUFFER_SIZE = 384;
+  char payloadBuffer[PAYLOAD_BUFFER_SIZE];
+  
+public:
+  WebhookNotifier();
+  
+  // Initialization
+  bool initialize(const String& url, bool enabled = true);
+  
+  // Notifier interface
+  const char* getName() const override { return "webhook"; }
+  bool isActive() const override { return enabled; }
+  bool send(const NotificationEvent& event) override;
+  RetryPolicy getRetryPolicy() const override { return {3, 2000, 30000}; }
+  
+private:
+  size_t formatPayload(const NotificationEvent& event);
+};
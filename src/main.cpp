@@ -8,9 +8,17 @@
 #include "core/infrastructure/wifi_service/wifi_service.h"
 #include "core/infrastructure/http_client/http_client.h"
 #include "core/infrastructure/telegram_service/telegram_service.h"
-#include "core/infrastructure/ssl_mutex_manager/ssl_mutex_manager.h"
+#include "core/infrastructure/webhook_notifier/webhook_notifier.h"
+#include "core/infrastructure/syslog_notifier/syslog_notifier.h"
+#include "core/infrastructure/notification_dispatcher/notification_dispatcher.h"
+#include "core/infrastructure/tls_budget/tls_budget.h"
 #include "core/infrastructure/memory_manager/memory_manager.h"
 #include "core/infrastructure/ntp_service/ntp_service.h"
+#include "core/infrastructure/dns_cache/dns_cache.h"
+#include "core/infrastructure/cpu_monitor/cpu_monitor.h"
+#include "core/infrastructure/task_watchdog/task_watchdog.h"
+#include "core/infrastructure/rtos_alloc/rtos_alloc.h"
+#include "core/infrastructure/stack_tuner/stack_tuner.h"
 #include "core/infrastructure/logger/logger.h"
 #include "ui/display_manager/display_manager.h"
 #include "ui/touch_handler/touch_handler.h"
@@ -22,10 +30,16 @@
 WiFiService* wifiService;
 HttpClient* httpClient;
 TelegramService* telegramService;
+WebhookNotifier* webhookNotifier;
+SyslogNotifier* syslogNotifier;
 DisplayManager* displayManager;
 NetworkMonitor* networkMonitor;
 TaskManager* taskManager;
 
+// loop() heartbeat slot (heartbeat prints can take a few seconds)
+static const uint32_t LOOP_DEADLINE_MS = 30000;
+int loopWatchdogSlot = -1;
+
 // LVGL display objects
 TFT_eSPI* tft;
 lv_disp_draw_buf_t draw_buf;
@@ -49,6 +63,7 @@ void display_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color
 void setup() {
   Serial.begin(115200);
   delay(2000);
+  RtosAlloc::markBoot();
   
   LOG_LEGACY("========================================");
   LOG_LEGACY("    NEBULA MONITOR v2.4 - CLEAN ARCH");
@@ -65,9 +80,14 @@ void setup() {
   // 1.5. Initialize logger interface after ConfigLoader is loaded
   ConfigLoader::initializeLoggerInterface();
   
+  // Before any task is created, stack sizes may come from the saved profile
+  // (recorded peaks only hold for the same number of workers sharing the probes)
+  StackTuner::initialize(StackTuner::parseMode(ConfigLoader::getStackTuningMode()),
+                         ConfigLoader::getStackTuningMargin(), ConfigLoader::getProbeWorkerCount());
+  
   // 2. Initialize TFT display
   LOG_MAIN("Initializing TFT display...");
-  tft = new TFT_eSPI();
+  tft = RtosAlloc::service<TFT_eSPI>();
   tft->init();
   tft->setRotation(2);
   tft->fillScreen(TFT_BLACK);
@@ -93,16 +113,18 @@ void setup() {
   
   // 4. Create service instances
   LOG_MAIN("Creating service instances...");
-  wifiService = new WiFiService();
-  httpClient = new HttpClient();
-  telegramService = new TelegramService();
-  displayManager = new DisplayManager();
-  networkMonitor = new NetworkMonitor();
-  taskManager = new TaskManager();
+  wifiService = RtosAlloc::service<WiFiService>();
+  httpClient = RtosAlloc::service<HttpClient>();
+  telegramService = RtosAlloc::service<TelegramService>();
+  webhookNotifier = RtosAlloc::service<WebhookNotifier>();
+  syslogNotifier = RtosAlloc::service<SyslogNotifier>();
+  displayManager = RtosAlloc::service<DisplayManager>();
+  networkMonitor = RtosAlloc::service<NetworkMonitor>();
+  taskManager = RtosAlloc::service<TaskManager>();
   
   // 5. Configure dependencies
   LOG_MAIN("Configuring dependencies...");
-  networkMonitor->setDependencies(wifiService, httpClient, telegramService, displayManager, taskManager);
+  networkMonitor->setDependencies(wifiService, httpClient, displayManager, taskManager);
   taskManager->setDependencies(networkMonitor, displayManager);
   
   // 6. Initialize memory manager (Garbage Collection)
@@ -112,16 +134,22 @@ void setup() {
     return;
   }
   
-  // 7. Initialize SSL mutex manager
-  LOG_MAIN("Initializing SSL mutex manager...");
-  if (!SSLMutexManager::initialize()) {
-    LOG_ERROR("Failed to initialize SSL mutex manager!");
+  // 7. Initialize TLS session budget
+  LOG_MAIN("Initializing TLS session budget...");
+  if (!TlsBudget::initialize(ConfigLoader::getTlsMaxSessions(), ConfigLoader::getTlsSessionHeap())) {
+    LOG_ERROR("Failed to initialize TLS session budget!");
     return;
   }
   
   // 8. Initialize services
   LOG_MAIN("Initializing services...");
   
+  // Shared DNS cache, used by everything below
+  DnsCache::configure(ConfigLoader::getDnsCacheTtlMs(), ConfigLoader::getDnsNegativeTtlMs());
+  
+  // CPU accounting (sampled from loop())
+  CpuMonitor::initialize(ConfigLoader::getCpuSampleIntervalMs());
+  
   // Initialize WiFi
   String ssid = ConfigLoader::getWifiSSID();
   String password = ConfigLoader::getWifiPassword();
@@ -146,10 +174,15 @@ void setup() {
   bool telegramEnabled = ConfigLoader::isTelegramEnabled();
   if (telegramService->initialize(botToken, chatId, telegramEnabled)) {
     LOG_MAIN("Telegram service initialized!");
+    telegramService->setCommandPolling(ConfigLoader::isTelegramCommandsEnabled(), ConfigLoader::getTelegramPollIntervalMs());
   } else {
     LOG_MAIN("Telegram service not available");
   }
   
+  // Initialize additional notifier backends
+  webhookNotifier->initialize(ConfigLoader::getWebhookUrl(), ConfigLoader::isWebhookEnabled());
+  syslogNotifier->initialize(ConfigLoader::getSyslogHost(), ConfigLoader::getSyslogPort(), ConfigLoader::isSyslogEnabled());
+  
   // Initialize display manager
   if (!displayManager->initialize()) {
     LOG_ERROR("Failed to initialize display manager!");
@@ -162,8 +195,8 @@ void setup() {
     return;
   }
   
-  // Set targets for display
-  displayManager->setTargets(networkMonitor->getTargets(), networkMonitor->getTargetCount());
+  // Show the targets the network monitor just published
+  displayManager->loadTargets();
   
   // Send test message with targets if Telegram is active and targets are loaded
   if (telegramService->isActive()) {
@@ -189,26 +222,48 @@ void setup() {
     LOG_WARN("Failed to initialize touch handler!");
   }
   
-  // 9. Initialize task manager
+  // 9. Start notification dispatcher (after the direct test message)
+  LOG_MAIN("Starting notification dispatcher...");
+  NotificationDispatcher::registerNotifier(telegramService);
+  NotificationDispatcher::registerNotifier(webhookNotifier);
+  NotificationDispatcher::registerNotifier(syslogNotifier);
+  if (!NotificationDispatcher::initialize()) {
+    LOG_WARN("Notification dispatcher failed, alerts disabled!");
+  }
+  
+  // 10. Initialize task manager
   if (!taskManager->initialize()) {
     LOG_ERROR("Failed to initialize task manager!");
     return;
   }
   
-  // 10. Start tasks
+  // 11. Start tasks
   LOG_MAIN("Starting FreeRTOS tasks...");
   if (!taskManager->startTasks()) {
     LOG_ERROR("Failed to start tasks!");
     return;
   }
   
+  // 12. Supervise task heartbeats (loop() included)
+  if (ConfigLoader::isWatchdogEnabled()) {
+    loopWatchdogSlot = TaskWatchdog::registerTask("loopTask", LOOP_DEADLINE_MS);
+    TaskWatchdog::attach(loopWatchdogSlot, xTaskGetCurrentTaskHandle());
+    if (!TaskWatchdog::initialize(ConfigLoader::getWatchdogTimeoutS())) {
+      LOG_WARN("Task watchdog failed, hung tasks won't be detected!");
+    }
+  }
+  
   LOG_LEGACY("========================================");
   LOG_LEGACY("    SYSTEM INITIALIZED SUCCESSFULLY!");
   LOG_LEGACY("========================================");
   LOG_LEGACY_F("Targets: %d", networkMonitor->getTargetCount());
   LOG_LEGACY_F("WiFi: %s", wifiService->isConnected() ? "Connected" : "Disconnected");
   LOG_LEGACY_F("Telegram: %s", telegramService->isActive() ? "Active" : "Inactive");
+  LOG_LEGACY_F("Notifiers: %d", NotificationDispatcher::getChannelCount());
   LOG_LEGACY("========================================");
+  
+  // Heap cost of boot (compare a default and a STATIC_ALLOCATION build)
+  RtosAlloc::printStatistics();
 }
 
 void loop() {
@@ -225,18 +280,28 @@ void loop() {
     
     // Print memory stats with heartbeat
     MemoryManager::getInstance().printMemoryStats();
+    NotificationDispatcher::printStatistics();
+    DnsCache::printStatistics();
+    TlsBudget::printStatistics();
+    TaskManager::printEventStatistics();
+    CpuMonitor::printStatistics();
+    StackTuner::printStatistics();
+    TaskWatchdog::printStatistics();
     
     lastHeartbeat = now;
   }
   
+  // Sliding-window CPU accounting
+  CpuMonitor::update();
+  StackTuner::update();
+  
   // Memory check every 10 seconds
   if (now - lastMemoryCheck >= 10000) {
     MemoryManager::getInstance().handleMemoryPressure();
     lastMemoryCheck = now;
   }
   
-  // Feed watchdog
-  MemoryManager::getInstance().feedWatchdog();
+  TaskWatchdog::feed(loopWatchdogSlot);
   
   delay(1000);
 }
@@ -1,19 +1,22 @@
 #include "ui/display_manager/display_manager.h"
 #include "ui/touch_handler/touch_handler.h"
 #include "ui/led_controller/led_controller.h"
+#include "core/infrastructure/cpu_monitor/cpu_monitor.h"
 #include <Arduino.h>
 #include <WiFi.h>
 #include "core/infrastructure/logger/logger.h"
 
 DisplayManager::DisplayManager() 
   : main_screen(nullptr), title_label(nullptr), footer(nullptr), footer_label(nullptr),
-    initialized(false), footer_mode(0), last_uptime_update(0), targets(nullptr), targetCount(0) {
+    initialized(false), footer_mode(0), last_uptime_update(0), targetCount(0), shown_sequence(0) {
   
   // Initialize status arrays
   for (int i = 0; i < 6; i++) {
     status_labels[i] = nullptr;
     name_labels[i] = nullptr;
     latency_labels[i] = nullptr;
+    shown_status[i] = UNKNOWN;
+    shown_latency[i] = 0;
   }
 }
 
@@ -44,45 +47,78 @@ bool DisplayManager::initialize() {
   return true;
 }
 
-void DisplayManager::setTargets(Target* targets, int count) {
-  this->targets = targets;
-  this->targetCount = count;
-  
+void DisplayManager::loadTargets() {
   // Update status items if already created
   if (initialized) {
     createStatusItems();
   }
 }
 
-void DisplayManager::update() {
-  if (!initialized) return;
+uint32_t DisplayManager::update() {
+  if (!initialized) return UPTIME_UPDATE_INTERVAL;
   
   // Handle LVGL tasks
-  lv_timer_handler();
+  uint32_t lvglWait = lv_timer_handler();
   
   // Handle touch input
   handleTouch();
   
+  // Catch up on publishes that reached the snapshot without an event of their own
+  if (StatusSnapshotStore::getSequence() != shown_sequence) {
+    refreshStatusItems();
+  }
+  
   // Update footer periodically
   if (millis() - last_uptime_update >= UPTIME_UPDATE_INTERVAL) {
     updateFooter();
     last_uptime_update = millis();
   }
   
-  // Update LED status
+  // Update LED status (WiFi blink runs on the same 500ms cadence)
   LEDController::update();
+  
+  // Sleep until the next footer refresh, unless LVGL or the touch needs us sooner
+  unsigned long sinceFooter = millis() - last_uptime_update;
+  uint32_t wait = sinceFooter < UPTIME_UPDATE_INTERVAL ? UPTIME_UPDATE_INTERVAL - sinceFooter : 0;
+  if (hasPendingRender() && lvglWait < wait) {
+    wait = lvglWait;
+  }
+  if (TouchHandler::isPressed() && TOUCH_POLL_INTERVAL < wait) {
+    wait = TOUCH_POLL_INTERVAL;
+  }
+  return wait;
 }
 
-void DisplayManager::updateTargetStatus(int index, Status status, uint16_t latency) {
-  if (index < 0 || index >= targetCount || !targets) return;
+bool DisplayManager::hasPendingRender() const {
+  // LVGL's refresh timer always reports a deadline; it only matters with dirty areas or animations
+  lv_disp_t* disp = lv_disp_get_default();
+  return (disp && disp->inv_p > 0) || lv_anim_count_running() > 0;
+}
+
+void DisplayManager::updateTargetStatus(int index) {
+  if (index < 0 || index >= targetCount) return;
   
-  Serial_printf("[DISPLAY] updateTargetStatus called: index=%d, status=%d, latency=%d\n", 
-               index, status, latency);
+  // The scanner publishes before it queues the event, the snapshot is at least as new
+  SnapshotView snapshot;
+  if (index >= snapshot->targetCount) return;
   
-  targets[index].setStatus(status);
-  targets[index].setLatency(latency);
+  Serial_printf("[DISPLAY] updateTargetStatus called: index=%d, snapshot #%lu\n", index,
+               (unsigned long)snapshot->sequence);
   
-  updateStatusItem(index);
+  updateStatusItem(index, snapshot->targets[index]);
+}
+
+void DisplayManager::refreshStatusItems() {
+  SnapshotView snapshot;
+  shown_sequence = snapshot->sequence;
+  
+  // Only items whose status or latency moved since they were drawn
+  for (int i = 0; i < targetCount && i < 6 && i < snapshot->targetCount; i++) {
+    const TargetSnapshot& target = snapshot->targets[i];
+    if (target.status != shown_status[i] || target.latency != shown_latency[i]) {
+      updateStatusItem(i, target);
+    }
+  }
 }
 
 void DisplayManager::onScanStarted() {
@@ -96,10 +132,13 @@ void DisplayManager::onScanCompleted() {
   
   // Determine LED status based on targets
   bool anyDown = false;
-  for (int i = 0; i < targetCount; i++) {
-    if (targets[i].isDown()) {
-      anyDown = true;
-      break;
+  {
+    SnapshotView snapshot;
+    for (int i = 0; i < snapshot->targetCount; i++) {
+      if (snapshot->targets[i].status == DOWN) {
+        anyDown = true;
+        break;
+      }
     }
   }
   
@@ -147,11 +186,15 @@ void DisplayManager::createMainScreen() {
 }
 
 void DisplayManager::createStatusItems() {
-  if (!targets) {
-    Serial_println("[DISPLAY] ERROR: No targets provided!");
+  SnapshotView snapshot;
+  if (snapshot->targetCount == 0) {
+    Serial_println("[DISPLAY] ERROR: No targets published yet!");
     return;
   }
   
+  targetCount = snapshot->targetCount;
+  shown_sequence = snapshot->sequence;
+  
   Serial_printf("[DISPLAY] Creating status items for %d targets\n", targetCount);
   
   // Find the main form container (it should be the second child of main_screen)
@@ -167,7 +210,8 @@ void DisplayManager::createStatusItems() {
   
   // Create status items for each target
   for (int i = 0; i < targetCount && i < 6; i++) {
-    Serial_printf("[DISPLAY] Creating status item %d for target: %s\n", i, targets[i].getName().c_str());
+    const TargetSnapshot& target = snapshot->targets[i];
+    Serial_printf("[DISPLAY] Creating status item %d for target: %s\n", i, target.name);
     
     // Status item container
     lv_obj_t* status_item = lv_obj_create(main_form);
@@ -183,7 +227,7 @@ void DisplayManager::createStatusItems() {
     
     // Target name label
     lv_obj_t* name_label = lv_label_create(status_item);
-    lv_label_set_text(name_label, targets[i].getName().c_str());
+    lv_label_set_text(name_label, target.name);
     lv_obj_set_style_text_color(name_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
     
     // Latency label
@@ -199,7 +243,7 @@ void DisplayManager::createStatusItems() {
     Serial_printf("[DISPLAY] Status item %d created successfully\n", i);
     
     // Update initial status
-    updateStatusItem(i);
+    updateStatusItem(i, target);
   }
 }
 
@@ -288,30 +332,31 @@ void DisplayManager::onStatusItemTouched(int index) {
   // Could show detail window here
 }
 
-void DisplayManager::updateStatusItem(int index) {
-  if (index < 0 || index >= targetCount || !targets) return;
+void DisplayManager::updateStatusItem(int index, const TargetSnapshot& target) {
+  if (index < 0 || index >= targetCount) return;
   
   // Additional safety checks
   if (index >= 6) return;
   
-  Target& target = targets[index];
+  shown_status[index] = target.status;
+  shown_latency[index] = target.latency;
   
   Serial_printf("[DISPLAY] Updating status item %d: %s - %s (%d ms)\n", 
-               index, target.getName().c_str(), 
-               target.getStatusText().c_str(), target.getLatency());
+               index, target.name, getStatusName(target.status), target.latency);
   
   // Update latency label with safety check
   if (latency_labels[index] && lv_obj_is_valid(latency_labels[index])) {
-    String latencyText = target.getLatencyText();
-    lv_label_set_text(latency_labels[index], latencyText.c_str());
-    Serial_printf("[DISPLAY] Updated latency label %d: %s\n", index, latencyText.c_str());
+    char latencyText[16];
+    formatLatency(latencyText, sizeof(latencyText), target);
+    lv_label_set_text(latency_labels[index], latencyText);
+    Serial_printf("[DISPLAY] Updated latency label %d: %s\n", index, latencyText);
   } else {
     Serial_printf("[DISPLAY] ERROR: Latency label %d is null or invalid!\n", index);
   }
   
   // Update colors with safety check
   if (status_labels[index] && lv_obj_is_valid(status_labels[index])) {
-    setStatusItemColor(index, target.getStatus(), target.getLatency());
+    setStatusItemColor(index, target.status, target.latency);
   } else {
     Serial_printf("[DISPLAY] ERROR: Status label %d is null or invalid!\n", index);
   }
@@ -327,6 +372,17 @@ void DisplayManager::updateStatusItem(int index) {
   lv_refr_now(NULL);
 }
 
+void DisplayManager::formatLatency(char* dst, size_t size, const TargetSnapshot& target) {
+  // Same wording as Target::getLatencyText(), without the String
+  if (target.status == UNREACHABLE) {
+    snprintf(dst, size, "UNREACH");
+  } else if (target.status != UP || target.latency == 0) {
+    snprintf(dst, size, "%s", target.healthCheck ? "FAIL" : "DOWN");
+  } else {
+    snprintf(dst, size, "%u%s", target.latency, target.healthCheck ? " OK" : " ms");
+  }
+}
+
 void DisplayManager::setStatusItemColor(int index, Status status, uint16_t latency) {
   if (index < 0 || index >= 6 || !status_labels[index]) return;
   
@@ -347,7 +403,7 @@ void DisplayManager::setStatusItemColor(int index, Status status, uint16_t laten
     bg_color = lv_color_hex(0x00FFFF); // Red for down
     text_color = lv_color_hex(0x000000);
   } else {
-    bg_color = lv_color_hex(0x111111); // Gray for unknown
+    bg_color = lv_color_hex(0x111111); // Gray for unknown / unreachable (parent down)
     text_color = lv_color_hex(0xCCCCCC);
   }
   
@@ -364,14 +420,17 @@ void DisplayManager::setStatusItemColor(int index, Status status, uint16_t laten
 }
 
 String DisplayManager::getFooterText() const {
-  if (!targets) return "No targets";
+  if (targetCount == 0) return "No targets";
   
   switch (footer_mode) {
     case 0: { // System Overview
       int active_alerts = 0, targets_up = 0;
-      for (int i = 0; i < targetCount; i++) {
-        if (targets[i].isDown()) active_alerts++;
-        if (targets[i].isHealthy()) targets_up++;
+      {
+        SnapshotView snapshot;
+        for (int i = 0; i < snapshot->targetCount; i++) {
+          if (snapshot->targets[i].status == DOWN) active_alerts++;
+          if (snapshot->targets[i].status == UP) targets_up++;
+        }
       }
       
       // Calculate uptime
@@ -403,7 +462,12 @@ String DisplayManager::getFooterText() const {
         rom_str = String(free_heap / 1024) + "KB";
       }
       
-      return "Cpu: 45% | Ram: " + String(heap_percent) + "% | HP: " + rom_str;
+      // Per-core load over the CPU monitor's window
+      uint16_t core0 = CpuMonitor::getCoreLoad(0);
+      uint16_t core1 = CpuMonitor::getCoreLoad(1);
+      String cpu_str = core0 == CpuMonitor::NO_DATA ? String("--") : String(core0 / 10) + "/" + String(core1 / 10);
+      
+      return "Cpu: " + cpu_str + "% | Ram: " + String(heap_percent) + "% | HP: " + rom_str;
     }
     default:
       return "Unknown mode";
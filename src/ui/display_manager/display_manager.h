@@ -1,7 +1,7 @@
 #pragma once
 #include <lvgl.h>
 #include "core/domain/status/status.h"
-#include "core/domain/target/target.h"
+#include "core/domain/status_snapshot/status_snapshot.h"
 #include <Arduino.h>
 
 class DisplayManager {
@@ -20,10 +20,13 @@ private:
   int footer_mode;
   unsigned long last_uptime_update;
   static const unsigned long UPTIME_UPDATE_INTERVAL = 500;
+  static const uint32_t TOUCH_POLL_INTERVAL = 20;   // while pressed, until release
   
-  // Target references
-  Target* targets;
+  // What the status items show, read from the published snapshot
   int targetCount;
+  uint32_t shown_sequence;
+  Status shown_status[6];
+  uint16_t shown_latency[6];
   
 public:
   DisplayManager();
@@ -31,11 +34,11 @@ public:
   
   // Initialization
   bool initialize();
-  void setTargets(Target* targets, int count);
+  void loadTargets();   // rebuild the status items from the published snapshot
   
-  // Main operations
-  void update();
-  void updateTargetStatus(int index, Status status, uint16_t latency);
+  // Main operations, returns ms until the next call is needed
+  uint32_t update();
+  void updateTargetStatus(int index);
   
   // Event handlers
   void onScanStarted();
@@ -58,8 +61,11 @@ public:
   
 private:
   // Internal UI methods
-  void updateStatusItem(int index);
+  void updateStatusItem(int index, const TargetSnapshot& target);
+  void refreshStatusItems();
+  static void formatLatency(char* dst, size_t size, const TargetSnapshot& target);
   void updateFooterContent();
   String getFooterText() const;
   void setStatusItemColor(int index, Status status, uint16_t latency);
+  bool hasPendingRender() const;
 };
@@ -4,6 +4,9 @@
 XPT2046_Touchscreen* TouchHandler::touchscreen = nullptr;
 SPIClass* TouchHandler::touchscreenSPI = nullptr;
 bool TouchHandler::initialized = false;
+volatile bool TouchHandler::irqPending = false;
+bool TouchHandler::pressed = false;
+TaskHandle_t TouchHandler::notifyTask = nullptr;
 
 bool TouchHandler::initialize() {
   if (initialized) return true;
@@ -23,6 +26,8 @@ bool TouchHandler::initialize() {
 }
 
 void TouchHandler::cleanup() {
+  detachInterrupt(digitalPinToInterrupt(T_IRQ));
+  
   if (touchscreen) {
     delete touchscreen;
     touchscreen = nullptr;
@@ -39,12 +44,22 @@ void TouchHandler::cleanup() {
 bool TouchHandler::isTouched() {
   if (!initialized || !touchscreen) return false;
   
-  if (touchscreen->tirqTouched()) {
-    TS_Point p = touchscreen->getPoint();
-    return p.z > 20; // Pressure threshold
-  }
+  // SPI is only read after a pen-down edge, then until release
+  if (!irqPending && !pressed) return false;
+  irqPending = false;
   
-  return false;
+  TS_Point p = touchscreen->getPoint();
+  pressed = p.z > 20; // Pressure threshold
+  return pressed;
+}
+
+void IRAM_ATTR TouchHandler::onTouchIrq() {
+  irqPending = true;
+  if (notifyTask) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(notifyTask, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
 }
 
 void TouchHandler::getTouchCoordinates(int16_t& x, int16_t& y) {
@@ -101,7 +116,8 @@ void TouchHandler::setupSPI() {
 }
 
 void TouchHandler::setupTouchscreen() {
-  touchscreen = new XPT2046_Touchscreen(T_CS, T_IRQ);
+  // No IRQ pin for the library: its own ISR would replace ours on that pin
+  touchscreen = new XPT2046_Touchscreen(T_CS);
   if (!touchscreen) {
     return;
   }
@@ -109,5 +125,8 @@ void TouchHandler::setupTouchscreen() {
   touchscreen->begin(*touchscreenSPI);
   touchscreen->setRotation(2); // Landscape rotation
   
+  pinMode(T_IRQ, INPUT);
+  attachInterrupt(digitalPinToInterrupt(T_IRQ), onTouchIrq, FALLING);
+  
   Serial_printf("[TOUCH] Touchscreen initialized - CS:%d IRQ:%d\n", T_CS, T_IRQ);
 }
@@ -2,6 +2,8 @@
 #include <Arduino.h>
 #include <XPT2046_Touchscreen.h>
 #include <SPI.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 class TouchHandler {
 private:
@@ -9,6 +11,11 @@ private:
   static SPIClass* touchscreenSPI;
   static bool initialized;
   
+  // Pen-down interrupt, wakes the display task instead of polling SPI
+  static volatile bool irqPending;
+  static bool pressed;
+  static TaskHandle_t notifyTask;
+  
   // Touch calibration
   static const int RAW_X_MIN = 200;
   static const int RAW_X_MAX = 3700;
@@ -29,6 +36,8 @@ public:
   
   // Touch detection
   static bool isTouched();
+  static bool isPressed() { return pressed; }   // still down, keep polling until release
+  static void setNotifyTask(TaskHandle_t task) { notifyTask = task; }
   static void getTouchCoordinates(int16_t& x, int16_t& y);
   static void getRawCoordinates(int16_t& x, int16_t& y, int16_t& z);
   
@@ -42,4 +51,5 @@ private:
   // Internal methods
   static void setupSPI();
   static void setupTouchscreen();
+  static void IRAM_ATTR onTouchIrq();
 };
@@ -0,0 +1,42 @@
+#pragma once
+// Host stand-in for the parts of the Arduino core the tested modules touch
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include "freertos/FreeRTOS.h"
+
+// Tests move time forward with hostMillisOffset instead of sleeping
+inline std::atomic<unsigned long> hostMillisOffset{0};
+
+inline unsigned long millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return hostMillisOffset + (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+class HostSerial {
+public:
+  void print(const char* text) { fputs(text, stdout); }
+  void println(const char* text = "") { puts(text); }
+  void printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+  }
+};
+inline HostSerial Serial;
+
+// Tests set the heap the budget logic sees
+class EspClass {
+public:
+  std::atomic<uint32_t> freeHeap{200000};
+  std::atomic<uint32_t> maxAllocHeap{100000};
+  uint32_t getFreeHeap() { return freeHeap; }
+  uint32_t getMaxAllocHeap() { return maxAllocHeap; }
+};
+inline EspClass ESP;
@@ -0,0 +1,48 @@
+#pragma once
+// Host stand-in: fixed-size item queues, never blocking
+#include "FreeRTOS.h"
+#include <deque>
+#include <string.h>
+#include <vector>
+
+struct HostQueue {
+  std::mutex mutex;
+  std::deque<std::vector<uint8_t>> items;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+};
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  HostQueue* queue = new HostQueue();
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t handle, const void* item, TickType_t) {
+  HostQueue* queue = static_cast<HostQueue*>(handle);
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (queue->items.size() >= queue->length) return pdFALSE;
+  const uint8_t* bytes = static_cast<const uint8_t*>(item);
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t handle, void* item, TickType_t) {
+  HostQueue* queue = static_cast<HostQueue*>(handle);
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (queue->items.empty()) return pdFALSE;
+  memcpy(item, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t handle) {
+  HostQueue* queue = static_cast<HostQueue*>(handle);
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return (UBaseType_t)queue->items.size();
+}
+
+inline void vQueueDelete(QueueHandle_t handle) {
+  delete static_cast<HostQueue*>(handle);
+}
@@ -0,0 +1,39 @@
+#pragma once
+// Host stand-in: binary semaphores on a condition variable
+#include "queue.h"
+#include <chrono>
+#include <condition_variable>
+
+struct HostSemaphore {
+  std::mutex mutex;
+  std::condition_variable ready;
+  bool given = false;
+};
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return new HostSemaphore();
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t ticks) {
+  HostSemaphore* semaphore = static_cast<HostSemaphore*>(handle);
+  std::unique_lock<std::mutex> lock(semaphore->mutex);
+  if (!semaphore->ready.wait_for(lock, std::chrono::milliseconds(ticks), [&] { return semaphore->given; })) {
+    return pdFALSE;
+  }
+  semaphore->given = false;
+  return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t handle) {
+  HostSemaphore* semaphore = static_cast<HostSemaphore*>(handle);
+  {
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    semaphore->given = true;
+  }
+  semaphore->ready.notify_all();
+  return pdTRUE;
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t handle) {
+  delete static_cast<HostSemaphore*>(handle);
+}
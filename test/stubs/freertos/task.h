@@ -0,0 +1,8 @@
+#pragma once
+// Host stand-in: tests drive task loop bodies directly, no scheduler
+#include "FreeRTOS.h"
+
+inline TickType_t xTaskGetTickCount() { return 0; }
+inline BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdTRUE; }
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+inline void vTaskDelete(TaskHandle_t) {}
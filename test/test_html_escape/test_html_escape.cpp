@@ -0,0 +1,60 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "core/infrastructure/telegram_service/html_escape.cpp"
+
+void setUp() {}
+void tearDown() {}
+
+void test_name_with_markup_is_escaped() {
+  char out[HTML_ESCAPED_SIZE(32)];
+  TEST_ASSERT_EQUAL_STRING("A&amp;B &lt;prod&gt;", escapeHtml("A&B <prod>", out, sizeof(out)));
+}
+
+void test_status_line_keeps_its_tags_balanced() {
+  // Same template as the /status reply
+  char name[HTML_ESCAPED_SIZE(32)];
+  char line[128];
+  snprintf(line, sizeof(line), "🟢 <b>%s</b> — %ums\n", escapeHtml("A&B <prod>", name, sizeof(name)), 42u);
+  TEST_ASSERT_EQUAL_STRING("🟢 <b>A&amp;B &lt;prod&gt;</b> — 42ms\n", line);
+}
+
+void test_quotes_and_plain_text() {
+  char out[HTML_ESCAPED_SIZE(32)];
+  TEST_ASSERT_EQUAL_STRING("say &quot;hi&quot;", escapeHtml("say \"hi\"", out, sizeof(out)));
+  TEST_ASSERT_EQUAL_STRING("Router 1", escapeHtml("Router 1", out, sizeof(out)));
+  TEST_ASSERT_EQUAL_STRING("", escapeHtml("", out, sizeof(out)));
+}
+
+void test_worst_case_fits_the_sized_buffer() {
+  char name[32];
+  memset(name, '&', sizeof(name) - 1);
+  name[sizeof(name) - 1] = '\0';
+  char out[HTML_ESCAPED_SIZE(sizeof(name))];
+  escapeHtml(name, out, sizeof(out));
+  TEST_ASSERT_EQUAL_UINT32(5 * (sizeof(name) - 1), strlen(out));
+}
+
+void test_truncation_never_splits_an_entity() {
+  char out[8];
+  // "A&amp;" is 6 bytes, "&lt;" would need 4 more
+  TEST_ASSERT_EQUAL_STRING("A&amp;", escapeHtml("A&<B", out, sizeof(out)));
+}
+
+void test_truncation_never_splits_a_utf8_sequence() {
+  char out[5];
+  // "ab" then a 4-byte emoji that does not fit in the remaining 2 bytes
+  TEST_ASSERT_EQUAL_STRING("ab", escapeHtml("ab🟢", out, sizeof(out)));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_name_with_markup_is_escaped);
+  RUN_TEST(test_status_line_keeps_its_tags_balanced);
+  RUN_TEST(test_quotes_and_plain_text);
+  RUN_TEST(test_worst_case_fits_the_sized_buffer);
+  RUN_TEST(test_truncation_never_splits_an_entity);
+  RUN_TEST(test_truncation_never_splits_a_utf8_sequence);
+  return UNITY_END();
+}
@@ -0,0 +1,155 @@
+#include <unity.h>
+
+#include "core/infrastructure/logger/logger_interface.cpp"
+#include "core/infrastructure/notification_dispatcher/notification_dispatcher.cpp"
+
+// Only queues are created in these tests; the task and watchdog are not started
+QueueHandle_t RtosAlloc::createQueue(UBaseType_t length, UBaseType_t itemSize) {
+  return xQueueCreate(length, itemSize);
+}
+BaseType_t RtosAlloc::createTask(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t, TaskHandle_t*,
+                                 BaseType_t, TaskBuffer&) {
+  return pdFAIL;
+}
+volatile TickType_t TaskWatchdog::heartbeats[TaskWatchdog::MAX_TASKS];
+int TaskWatchdog::registerTask(const char*, uint32_t) { return -1; }
+void TaskWatchdog::attach(int, TaskHandle_t) {}
+void TaskWatchdog::unregisterTask(int) {}
+
+// Backend whose next send() results are scripted by the test
+class FakeNotifier : public Notifier {
+public:
+  RetryPolicy policy;
+  bool succeed = false;
+  int sends = 0;
+
+  explicit FakeNotifier(RetryPolicy retryPolicy) : policy(retryPolicy) {}
+  const char* getName() const override { return "fake"; }
+  bool isActive() const override { return true; }
+  bool send(const NotificationEvent&) override {
+    sends++;
+    return succeed;
+  }
+  RetryPolicy getRetryPolicy() const override { return policy; }
+};
+
+static NotificationEvent makeAlert(int8_t targetIndex) {
+  NotificationEvent event;
+  memset(&event, 0, sizeof(event));
+  event.type = NotificationType::ALERT;
+  event.targetIndex = targetIndex;
+  event.status = DOWN;
+  strncpy(event.targetName, "A&B <prod>", sizeof(event.targetName) - 1);
+  return event;
+}
+
+static void advance(unsigned long ms) {
+  hostMillisOffset += ms;
+}
+
+void setUp() {
+  hostMillisOffset = 0;
+}
+
+void tearDown() {
+  NotificationDispatcher::cleanup();
+}
+
+void test_retries_back_off_exponentially_up_to_the_cap() {
+  FakeNotifier backend({5, 1000, 3000});
+  TEST_ASSERT_TRUE(NotificationDispatcher::registerNotifier(&backend));
+  TEST_ASSERT_TRUE(NotificationDispatcher::dispatch(makeAlert(0)));
+
+  // 1s, 2s, then capped at 3s
+  uint32_t expected[] = {1000, 2000, 3000, 3000};
+  for (uint32_t backoff : expected) {
+    int sends = backend.sends;
+    NotificationDispatcher::processOnce();
+    TEST_ASSERT_EQUAL_INT(sends + 1, backend.sends);
+
+    // Nothing is sent again before the backoff has elapsed
+    advance(backoff - 1);
+    NotificationDispatcher::processOnce();
+    TEST_ASSERT_EQUAL_INT(sends + 1, backend.sends);
+    advance(1);
+  }
+
+  NotificationDispatcher::ChannelStats stats;
+  TEST_ASSERT_TRUE(NotificationDispatcher::getChannelStats(0, stats));
+  TEST_ASSERT_EQUAL_UINT32(4, stats.retries);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.failed);
+}
+
+void test_gives_up_after_max_attempts_and_reports_undelivered() {
+  FakeNotifier backend({3, 1000, 60000});
+  TEST_ASSERT_TRUE(NotificationDispatcher::registerNotifier(&backend));
+  TEST_ASSERT_TRUE(NotificationDispatcher::dispatch(makeAlert(4)));
+
+  NotificationDispatcher::Receipt receipt;
+  NotificationDispatcher::processOnce();
+  advance(1000);
+  NotificationDispatcher::processOnce();
+  TEST_ASSERT_FALSE(NotificationDispatcher::takeReceipt(receipt));
+  advance(2000);
+  NotificationDispatcher::processOnce();
+  TEST_ASSERT_EQUAL_INT(3, backend.sends);
+
+  NotificationDispatcher::ChannelStats stats;
+  NotificationDispatcher::getChannelStats(0, stats);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.failed);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.retries);
+
+  TEST_ASSERT_TRUE(NotificationDispatcher::takeReceipt(receipt));
+  TEST_ASSERT_EQUAL_INT(4, receipt.targetIndex);
+  TEST_ASSERT_FALSE(receipt.delivered);
+
+  // The event is gone, the channel is idle again
+  advance(60000);
+  NotificationDispatcher::processOnce();
+  TEST_ASSERT_EQUAL_INT(3, backend.sends);
+}
+
+void test_first_success_is_reported_without_waiting_for_other_backends() {
+  FakeNotifier failing({4, 5000, 60000});
+  FakeNotifier working({4, 5000, 60000});
+  working.succeed = true;
+  TEST_ASSERT_TRUE(NotificationDispatcher::registerNotifier(&failing));
+  TEST_ASSERT_TRUE(NotificationDispatcher::registerNotifier(&working));
+  TEST_ASSERT_TRUE(NotificationDispatcher::dispatch(makeAlert(2)));
+
+  NotificationDispatcher::processOnce();
+  NotificationDispatcher::Receipt receipt;
+  TEST_ASSERT_TRUE(NotificationDispatcher::takeReceipt(receipt));
+  TEST_ASSERT_EQUAL_INT(2, receipt.targetIndex);
+  TEST_ASSERT_TRUE(receipt.delivered);
+
+  // The failing backend giving up later does not send a second receipt
+  for (int i = 0; i < 4; i++) {
+    advance(60000);
+    NotificationDispatcher::processOnce();
+  }
+  TEST_ASSERT_EQUAL_INT(4, failing.sends);
+  TEST_ASSERT_FALSE(NotificationDispatcher::takeReceipt(receipt));
+}
+
+void test_full_queues_reject_the_alert() {
+  FakeNotifier backend({4, 5000, 60000});
+  TEST_ASSERT_TRUE(NotificationDispatcher::registerNotifier(&backend));
+  for (UBaseType_t i = 0; i < NotificationDispatcher::QUEUE_DEPTH; i++) {
+    TEST_ASSERT_TRUE(NotificationDispatcher::dispatch(makeAlert(1)));
+  }
+  TEST_ASSERT_FALSE(NotificationDispatcher::dispatch(makeAlert(3)));
+
+  NotificationDispatcher::ChannelStats stats;
+  NotificationDispatcher::getChannelStats(0, stats);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.overflow);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_retries_back_off_exponentially_up_to_the_cap);
+  RUN_TEST(test_gives_up_after_max_attempts_and_reports_undelivered);
+  RUN_TEST(test_first_success_is_reported_without_waiting_for_other_backends);
+  RUN_TEST(test_full_queues_reject_the_alert);
+  return UNITY_END();
+}
@@ -0,0 +1,112 @@
+#include <unity.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/infrastructure/logger/logger_interface.cpp"
+#include "core/infrastructure/tls_budget/tls_budget.cpp"
+
+// Only the semaphore factory is needed from RtosAlloc here
+SemaphoreHandle_t RtosAlloc::createBinarySemaphore() {
+  return xSemaphoreCreateBinary();
+}
+
+static void sleepMs(int ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void setUp() {
+  ESP.freeHeap = 200000;
+  ESP.maxAllocHeap = 100000;
+  TEST_ASSERT_TRUE(TlsBudget::initialize(2, 45000));
+}
+
+void tearDown() {
+  TlsBudget::cleanup();
+}
+
+void test_waiters_are_served_by_priority_then_fifo() {
+  TEST_ASSERT_TRUE(TlsBudget::acquire(TlsBudget::PRIORITY_PROBE, 0));
+  TEST_ASSERT_TRUE(TlsBudget::acquire(TlsBudget::PRIORITY_PROBE, 0));
+  TEST_ASSERT_FALSE(TlsBudget::acquire(TlsBudget::PRIORITY_PROBE, 0));
+
+  std::vector<int> order;
+  std::mutex orderLock;
+  auto waiter = [&](TlsBudget::Priority priority, int id, int startDelay) {
+    sleepMs(startDelay);
+    bool granted = TlsBudget::acquire(priority, 3000);
+    {
+      std::lock_guard<std::mutex> lock(orderLock);
+      order.push_back(granted ? id : -id);
+    }
+    sleepMs(30);
+    if (granted) TlsBudget::release();
+  };
+
+  // Queued as probe, probe, alert, command
+  std::thread probe1(waiter, TlsBudget::PRIORITY_PROBE, 1, 0);
+  std::thread probe2(waiter, TlsBudget::PRIORITY_PROBE, 2, 20);
+  std::thread alert(waiter, TlsBudget::PRIORITY_ALERT, 3, 40);
+  std::thread command(waiter, TlsBudget::PRIORITY_COMMAND, 4, 60);
+  sleepMs(150);
+  TlsBudget::release();
+  sleepMs(10);
+  TlsBudget::release();
+  probe1.join();
+  probe2.join();
+  alert.join();
+  command.join();
+
+  int expected[] = {3, 4, 1, 2};
+  TEST_ASSERT_EQUAL_UINT32(4, order.size());
+  TEST_ASSERT_EQUAL_INT_ARRAY(expected, order.data(), 4);
+  TEST_ASSERT_EQUAL_UINT8(0, TlsBudget::getInUse());
+}
+
+void test_low_heap_allows_a_single_session() {
+  ESP.freeHeap = 50000;
+  // Nothing open: one session is always allowed
+  TEST_ASSERT_TRUE(TlsBudget::acquire(TlsBudget::PRIORITY_PROBE, 0));
+  TEST_ASSERT_EQUAL_UINT8(1, TlsBudget::getBudget());
+  TEST_ASSERT_FALSE(TlsBudget::acquire(TlsBudget::PRIORITY_ALERT, 100));
+
+  TlsBudget::Stats alertStats;
+  TEST_ASSERT_TRUE(TlsBudget::getPriorityStats(TlsBudget::PRIORITY_ALERT, alertStats));
+  TEST_ASSERT_EQUAL_UINT32(1, alertStats.timeouts);
+  TlsBudget::release();
+}
+
+void test_waiter_is_granted_when_heap_frees_up() {
+  ESP.freeHeap = 50000;
+  TEST_ASSERT_TRUE(TlsBudget::acquire(TlsBudget::PRIORITY_PROBE, 0));
+
+  bool granted = false;
+  std::thread alert([&] {
+    granted = TlsBudget::acquire(TlsBudget::PRIORITY_ALERT, 1000);
+    if (granted) TlsBudget::release();
+  });
+  // No release happens, the periodic recheck must notice the heap
+  sleepMs(50);
+  ESP.freeHeap = 200000;
+  alert.join();
+
+  TEST_ASSERT_TRUE(granted);
+  TlsBudget::release();
+  TEST_ASSERT_EQUAL_UINT8(0, TlsBudget::getInUse());
+}
+
+void test_small_largest_block_blocks_a_second_session() {
+  ESP.maxAllocHeap = 10000;
+  TEST_ASSERT_TRUE(TlsBudget::acquire(TlsBudget::PRIORITY_PROBE, 0));
+  TEST_ASSERT_FALSE(TlsBudget::acquire(TlsBudget::PRIORITY_COMMAND, 0));
+  TlsBudget::release();
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_waiters_are_served_by_priority_then_fifo);
+  RUN_TEST(test_low_heap_allows_a_single_session);
+  RUN_TEST(test_waiter_is_granted_when_heap_frees_up);
+  RUN_TEST(test_small_largest_block_blocks_a_second_session);
+  return UNITY_END();
+}
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""
+Local stand-in receivers for the notifier backends.
+
+Runs an HTTP server that accepts webhook POSTs and a UDP listener for syslog
+messages, printing everything the monitor sends. Point WEBHOOK_URL and
+SYSLOG_HOST/SYSLOG_PORT at this machine to exercise the dispatcher without
+external services.
+
+Usage: python3 tools/notifier_receiver.py [--http-port 8080] [--syslog-port 5514] [--fail N]
+  --fail N  answer the first N webhook requests with HTTP 503 to exercise retries
+"""
+
+import argparse
+import json
+import socket
+import threading
+from datetime import datetime
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+state = {"fail_remaining": 0}
+
+
+def log(source, message):
+    print(f"[{datetime.now().strftime('%H:%M:%S')}] {source}: {message}", flush=True)
+
+
+class WebhookHandler(BaseHTTPRequestHandler):
+    def do_POST(self):
+        length = int(self.headers.get("Content-Length", 0))
+        body = self.rfile.read(length).decode("utf-8", errors="replace")
+
+        if state["fail_remaining"] > 0:
+            state["fail_remaining"] -= 1
+            log("WEBHOOK", f"simulated failure (503), {state['fail_remaining']} left")
+            self.send_response(503)
+            self.end_headers()
+            return
+
+        try:
+            log("WEBHOOK", json.dumps(json.loads(body)))
+        except ValueError:
+            log("WEBHOOK", f"INVALID JSON: {body}")
+
+        self.send_response(204)
+        self.end_headers()
+
+    def log_message(self, format, *args):
+        pass
+
+
+def syslog_listener(port):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("0.0.0.0", port))
+    log("SYSLOG", f"listening on udp/{port}")
+    while True:
+        data, addr = sock.recvfrom(2048)
+        log("SYSLOG", f"{addr[0]} {data.decode('utf-8', errors='replace')}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Nebula Monitor notifier stand-in receivers")
+    parser.add_argument("--http-port", type=int, default=8080)
+    parser.add_argument("--syslog-port", type=int, default=5514)
+    parser.add_argument("--fail", type=int, default=0)
+    args = parser.parse_args()
+
+    state["fail_remaining"] = args.fail
+
+    threading.Thread(target=syslog_listener, args=(args.syslog_port,), daemon=True).start()
+
+    server = HTTPServer(("0.0.0.0", args.http_port), WebhookHandler)
+    log("WEBHOOK", f"listening on http/{args.http_port}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()